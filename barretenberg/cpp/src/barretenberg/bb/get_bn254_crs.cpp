@@ -1,5 +1,91 @@
 #include "get_bn254_crs.hpp"
 #include "barretenberg/bb/file_io.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/thread_utils.hpp"
+#include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include <array>
+
+namespace {
+
+constexpr size_t G1_POINT_SIZE = 64;
+// The cached crs is read in chunks of this many points (4MB), so that deserialising one chunk overlaps with reading the
+// next one.
+constexpr size_t CRS_CHUNK_NUM_POINTS = 1 << 16;
+constexpr size_t MIN_POINTS_PER_THREAD = 1 << 10;
+
+/**
+ * @brief Deserialise `num_points` flat g1 points from `data` into `out`, in parallel.
+ *
+ * @details If `point_table` is set, `out` is filled in the pippenger point table form (every point followed by its
+ * endomorphism, see `generate_pippenger_point_table`) rather than with the points alone.
+ */
+void deserialize_g1_points(uint8_t const* data,
+                           size_t num_points,
+                           barretenberg::g1::affine_element* out,
+                           bool point_table)
+{
+    const size_t num_threads = barretenberg::thread_utils::calculate_num_threads(num_points, MIN_POINTS_PER_THREAD);
+    const size_t points_per_thread = (num_points + num_threads - 1) / num_threads;
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = thread_idx * points_per_thread;
+        const size_t end = std::min(start + points_per_thread, num_points);
+        if (start >= end) {
+            return;
+        }
+        auto* dest = point_table ? out + 2 * start : out + start;
+        for (size_t i = start; i < end; ++i) {
+            dest[i - start] = from_buffer<barretenberg::g1::affine_element>(data, i * G1_POINT_SIZE);
+        }
+        if (point_table) {
+            // Expands in place, this thread's slice of the table only holds its own points.
+            barretenberg::scalar_multiplication::generate_pippenger_point_table<curve::BN254>(dest, dest, end - start);
+        }
+    });
+}
+
+/**
+ * @brief Stream the first `num_points` points of a flat g1 file into `out` (see `deserialize_g1_points`).
+ *
+ * @details While one chunk is being deserialised by the thread pool, the next one is read on a separate thread.
+ */
+void read_g1_points(std::string const& filename,
+                    size_t num_points,
+                    barretenberg::g1::affine_element* out,
+                    bool point_table)
+{
+    std::ifstream file(filename, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Unable to open file: " + filename);
+    }
+
+    std::array<std::vector<uint8_t>, 2> buffers;
+    const auto read_chunk = [&](std::vector<uint8_t>& buffer, size_t chunk_start) {
+        buffer.resize(std::min(CRS_CHUNK_NUM_POINTS, num_points - chunk_start) * G1_POINT_SIZE);
+        file.read(reinterpret_cast<char*>(buffer.data()), (std::streamsize)buffer.size());
+    };
+
+    read_chunk(buffers[0], 0);
+    for (size_t chunk_start = 0, idx = 0; chunk_start < num_points; chunk_start += CRS_CHUNK_NUM_POINTS, idx ^= 1) {
+        const size_t next_chunk_start = chunk_start + CRS_CHUNK_NUM_POINTS;
+        std::thread reader;
+        if (next_chunk_start < num_points) {
+            reader = std::thread(read_chunk, std::ref(buffers[idx ^ 1]), next_chunk_start);
+        }
+        auto const& chunk = buffers[idx];
+        auto* dest = point_table ? out + 2 * chunk_start : out + chunk_start;
+        deserialize_g1_points(chunk.data(), chunk.size() / G1_POINT_SIZE, dest, point_table);
+        if (reader.joinable()) {
+            reader.join();
+        }
+    }
+
+    if (!file) {
+        throw std::runtime_error("Failed to read g1 data from: " + filename);
+    }
+}
+
+} // namespace
 
 std::vector<uint8_t> download_bn254_g1_data(size_t num_points)
 {
@@ -25,7 +111,15 @@ std::vector<uint8_t> download_bn254_g2_data()
     return exec_pipe(command);
 }
 
-std::vector<barretenberg::g1::affine_element> get_bn254_g1_data(const std::filesystem::path& path, size_t num_points)
+namespace {
+/**
+ * @brief Fill `out` with the first `num_points` crs points, from the cache at `path` if it is large enough, downloading
+ * (and caching) them otherwise.
+ */
+void load_bn254_g1_points(const std::filesystem::path& path,
+                          size_t num_points,
+                          barretenberg::g1::affine_element* out,
+                          bool point_table)
 {
     std::filesystem::create_directories(path);
 
@@ -34,25 +128,33 @@ std::vector<barretenberg::g1::affine_element> get_bn254_g1_data(const std::files
 
     if (g1_file_size >= num_points * 64 && g1_file_size % 64 == 0) {
         vinfo("using cached crs of size ", std::to_string(g1_file_size / 64), " at ", g1_path);
-        auto data = read_file(g1_path, g1_file_size);
-        auto points = std::vector<barretenberg::g1::affine_element>(num_points);
-        for (size_t i = 0; i < num_points; ++i) {
-            points[i] = from_buffer<barretenberg::g1::affine_element>(data, i * 64);
-        }
-        return points;
+        read_g1_points(g1_path, num_points, out, point_table);
+        return;
     }
 
     vinfo("downloading crs...");
     auto data = download_bn254_g1_data(num_points);
     write_file(g1_path, data);
+    deserialize_g1_points(data.data(), num_points, out, point_table);
+}
+} // namespace
 
+std::vector<barretenberg::g1::affine_element> get_bn254_g1_data(const std::filesystem::path& path, size_t num_points)
+{
     auto points = std::vector<barretenberg::g1::affine_element>(num_points);
-    for (size_t i = 0; i < num_points; ++i) {
-        points[i] = from_buffer<barretenberg::g1::affine_element>(data, i * 64);
-    }
+    load_bn254_g1_points(path, num_points, points.data(), false);
     return points;
 }
 
+std::shared_ptr<barretenberg::g1::affine_element[]> get_bn254_g1_point_table(const std::filesystem::path& path,
+                                                                             size_t num_points)
+{
+    auto point_table =
+        barretenberg::scalar_multiplication::point_table_alloc<barretenberg::g1::affine_element>(num_points);
+    load_bn254_g1_points(path, num_points, point_table.get(), true);
+    return point_table;
+}
+
 barretenberg::g2::affine_element get_bn254_g2_data(const std::filesystem::path& path)
 {
     std::filesystem::create_directories(path);
@@ -68,4 +170,4 @@ barretenberg::g2::affine_element get_bn254_g2_data(const std::filesystem::path&
     auto data = download_bn254_g2_data();
     write_file(g2_path, data);
     return from_buffer<barretenberg::g2::affine_element>(data.data());
-}
\ No newline at end of file
+}
@@ -9,4 +9,7 @@
 #include <ios>
 
 std::vector<barretenberg::g1::affine_element> get_bn254_g1_data(const std::filesystem::path& path, size_t num_points);
+// Loads the g1 points directly in the form of a pippenger point table, expanding chunks as they are read.
+std::shared_ptr<barretenberg::g1::affine_element[]> get_bn254_g1_point_table(const std::filesystem::path& path,
+                                                                             size_t num_points);
 barretenberg::g2::affine_element get_bn254_g2_data(const std::filesystem::path& path);
\ No newline at end of file
@@ -39,9 +39,9 @@ acir_proofs::AcirComposer init(acir_format::acir_format& constraint_system)
     auto subgroup_size = acir_composer.get_circuit_subgroup_size();
 
     // Must +1!
-    auto bn254_g1_data = get_bn254_g1_data(CRS_PATH, subgroup_size + 1);
+    auto bn254_g1_point_table = get_bn254_g1_point_table(CRS_PATH, subgroup_size + 1);
     auto bn254_g2_data = get_bn254_g2_data(CRS_PATH);
-    srs::init_crs_factory(bn254_g1_data, bn254_g2_data);
+    srs::init_crs_factory(bn254_g1_point_table, subgroup_size + 1, bn254_g2_data);
 
     return acir_composer;
 }
@@ -54,9 +54,9 @@ void init_reference_strings()
 
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/811) reduce duplication with above
     // Must +1!
-    auto g1_data = get_bn254_g1_data(CRS_PATH, hardcoded_subgroup_size_hack + 1);
+    auto g1_point_table = get_bn254_g1_point_table(CRS_PATH, hardcoded_subgroup_size_hack + 1);
     auto g2_data = get_bn254_g2_data(CRS_PATH);
-    srs::init_crs_factory(g1_data, g2_data);
+    srs::init_crs_factory(g1_point_table, hardcoded_subgroup_size_hack + 1, g2_data);
 
     // Must +1!
     auto grumpkin_g1_data = get_grumpkin_g1_data(CRS_PATH, hardcoded_subgroup_size_hack + 1);
@@ -0,0 +1,88 @@
+#include "barretenberg/bb/get_bn254_crs.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace barretenberg;
+
+// get_bn254_crs.cpp logs through bb's vinfo, which expects the binary to define this.
+bool verbose = false;
+
+namespace {
+
+constexpr size_t MIN_LOG_NUM_POINTS = 16;
+constexpr size_t MAX_LOG_NUM_POINTS = 20;
+
+/**
+ * @brief Write a flat bn254_g1.dat of 2^MAX_LOG_NUM_POINTS points to a temporary crs directory, so the benchmarks never
+ * hit the network. The points are consecutive multiples of the generator, which is as good as the real crs here.
+ */
+std::filesystem::path get_crs_path()
+{
+    static const std::filesystem::path crs_path = []() {
+        auto path = std::filesystem::temp_directory_path() / "bb_crs_bench";
+        std::filesystem::create_directories(path);
+        const size_t num_points = 1UL << MAX_LOG_NUM_POINTS;
+        if (get_file_size(path / "bn254_g1.dat") != num_points * 64) {
+            std::vector<g1::element> points(num_points);
+            points[0] = g1::one;
+            for (size_t i = 1; i < num_points; ++i) {
+                points[i] = points[i - 1] + g1::one;
+            }
+            g1::element::batch_normalize(points.data(), num_points);
+
+            using serialize::write;
+            std::vector<uint8_t> data;
+            data.reserve(num_points * 64);
+            for (auto const& point : points) {
+                write(data, g1::affine_element(point.x, point.y));
+            }
+            write_file(path / "bn254_g1.dat", data);
+        }
+        return path;
+    }();
+    return crs_path;
+}
+
+// The previous loader: read the whole file, then deserialise every point on one thread.
+void load_crs_serial(State& state) noexcept
+{
+    const size_t num_points = 1UL << static_cast<size_t>(state.range(0));
+    const auto g1_path = get_crs_path() / "bn254_g1.dat";
+    for (auto _ : state) {
+        auto data = read_file(g1_path, num_points * 64);
+        auto points = std::vector<g1::affine_element>(num_points);
+        for (size_t i = 0; i < num_points; ++i) {
+            points[i] = from_buffer<g1::affine_element>(data, i * 64);
+        }
+        DoNotOptimize(points.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_points));
+}
+
+void load_crs_points(State& state) noexcept
+{
+    const size_t num_points = 1UL << static_cast<size_t>(state.range(0));
+    const auto crs_path = get_crs_path();
+    for (auto _ : state) {
+        DoNotOptimize(get_bn254_g1_data(crs_path, num_points).data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_points));
+}
+
+void load_crs_point_table(State& state) noexcept
+{
+    const size_t num_points = 1UL << static_cast<size_t>(state.range(0));
+    const auto crs_path = get_crs_path();
+    for (auto _ : state) {
+        DoNotOptimize(get_bn254_g1_point_table(crs_path, num_points).get());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_points));
+}
+
+} // namespace
+
+// Throughput is reported in points per second (items_per_second).
+BENCHMARK(load_crs_serial)->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS, 2)->Unit(kMillisecond);
+BENCHMARK(load_crs_points)->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS, 2)->Unit(kMillisecond);
+BENCHMARK(load_crs_point_table)->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS, 2)->Unit(kMillisecond);
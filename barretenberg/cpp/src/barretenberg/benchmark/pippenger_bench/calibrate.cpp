@@ -0,0 +1,129 @@
+/**
+ * Calibrates the pippenger bucket widths of `bucket_width_table` on this machine.
+ *
+ * For every curve and every log2 size in [min_log_size, max_log_size] (default [16, 24]), we time `pippenger_unsafe`
+ * for the heuristic bucket width and its neighbours, and print the fastest width per size, followed by tables that
+ * can be copied into `get_bucket_width_table<Curve>()`.
+ *
+ * Usage: pippenger_calibrate [min_log_size] [max_log_size] [num_repetitions]
+ */
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace barretenberg;
+
+namespace {
+
+constexpr size_t WIDTH_SEARCH_RADIUS = 3;
+
+template <typename Curve>
+scalar_multiplication::bucket_width_table calibrate(const std::string& curve_name,
+                                                    const size_t min_log_size,
+                                                    const size_t max_log_size,
+                                                    const size_t num_repetitions)
+{
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    const size_t max_num_points = 1ULL << max_log_size;
+
+    // Multiples of a random point by pseudo-random 64-bit scalars are much cheaper to generate than random points, and
+    // are as good for `pippenger_unsafe` (no partial bucket sums collide, except with negligible probability)
+    std::vector<Element> projective_points(max_num_points);
+    const Element generator = Element::random_element();
+    parallel_for(max_num_points, [&](size_t i) {
+        // splitmix64
+        uint64_t multiplier = static_cast<uint64_t>(i) + 0x9e3779b97f4a7c15ULL;
+        multiplier = (multiplier ^ (multiplier >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        multiplier = (multiplier ^ (multiplier >> 27)) * 0x94d049bb133111ebULL;
+        multiplier = multiplier ^ (multiplier >> 31);
+        projective_points[i] = generator * Fr(multiplier);
+    });
+    Element::batch_normalize(&projective_points[0], max_num_points);
+    auto points = scalar_multiplication::point_table_alloc<AffineElement>(max_num_points);
+    for (size_t i = 0; i < max_num_points; ++i) {
+        points.get()[i] = AffineElement(projective_points[i].x, projective_points[i].y);
+    }
+    projective_points.clear();
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), max_num_points);
+
+    std::vector<Fr> scalars(max_num_points);
+    for (auto& scalar : scalars) {
+        scalar = Fr::random_element();
+    }
+
+    auto& table = scalar_multiplication::get_bucket_width_table<Curve>();
+    scalar_multiplication::bucket_width_table result;
+    for (size_t log_size = min_log_size; log_size <= max_log_size; ++log_size) {
+        const size_t num_points = 1ULL << log_size;
+        const size_t default_width = scalar_multiplication::get_optimal_bucket_width(num_points);
+        const size_t min_width = default_width > WIDTH_SEARCH_RADIUS ? default_width - WIDTH_SEARCH_RADIUS : 1;
+        const size_t max_width =
+            std::min(default_width + WIDTH_SEARCH_RADIUS, scalar_multiplication::bucket_width_table::MAX_BUCKET_WIDTH);
+
+        size_t best_width = default_width;
+        int64_t best_time = std::numeric_limits<int64_t>::max();
+        for (size_t width = min_width; width <= max_width; ++width) {
+            // the runtime state is sized for the table, so it has to be constructed after the table is set
+            table.widths[log_size] = static_cast<uint8_t>(width);
+            scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+            int64_t time = std::numeric_limits<int64_t>::max();
+            for (size_t k = 0; k < num_repetitions; ++k) {
+                const auto start = std::chrono::steady_clock::now();
+                scalar_multiplication::pippenger_unsafe<Curve>(&scalars[0], points.get(), num_points, state);
+                const auto end = std::chrono::steady_clock::now();
+                time = std::min(time, std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+            }
+            std::cout << curve_name << " 2^" << log_size << " width " << width << ": " << time << "us" << std::endl;
+            if (time < best_time) {
+                best_time = time;
+                best_width = width;
+            }
+        }
+        table.widths[log_size] = 0;
+        result.widths[log_size] = static_cast<uint8_t>(best_width);
+        std::cout << curve_name << " 2^" << log_size << " best width " << best_width << " (heuristic "
+                  << default_width << ")" << std::endl;
+    }
+    return result;
+}
+
+void print_table(const std::string& curve_name, const scalar_multiplication::bucket_width_table& table)
+{
+    std::cout << "// " << curve_name << std::endl << "{ ";
+    for (size_t i = 0; i < scalar_multiplication::bucket_width_table::MAX_LOG_NUM_POINTS; ++i) {
+        std::cout << static_cast<size_t>(table.widths[i])
+                  << (i + 1 < scalar_multiplication::bucket_width_table::MAX_LOG_NUM_POINTS ? ", " : " }");
+    }
+    std::cout << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const size_t min_log_size = argc > 1 ? std::stoul(argv[1]) : 16;
+    const size_t max_log_size = argc > 2 ? std::stoul(argv[2]) : 24;
+    const size_t num_repetitions = argc > 3 ? std::stoul(argv[3]) : 3;
+    if (min_log_size < 1 || min_log_size > max_log_size ||
+        max_log_size >= scalar_multiplication::bucket_width_table::MAX_LOG_NUM_POINTS) {
+        std::cerr << "invalid size range" << std::endl;
+        return 1;
+    }
+
+    const auto bn254_table = calibrate<curve::BN254>("bn254", min_log_size, max_log_size, num_repetitions);
+    const auto grumpkin_table = calibrate<curve::Grumpkin>("grumpkin", min_log_size, max_log_size, num_repetitions);
+    print_table("bn254", bn254_table);
+    print_table("grumpkin", grumpkin_table);
+    return 0;
+}
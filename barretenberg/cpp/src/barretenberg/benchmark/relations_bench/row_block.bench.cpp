@@ -0,0 +1,117 @@
+#include "barretenberg/flavor/ultra.hpp"
+#include "barretenberg/relations/utils.hpp"
+#include <benchmark/benchmark.h>
+
+namespace {
+auto& engine = numeric::random::get_debug_engine();
+}
+
+namespace proof_system::benchmark::row_block {
+
+using Flavor = honk::flavor::Ultra;
+using FF = typename Flavor::FF;
+using AllValues = typename Flavor::AllValues;
+using ProverPolynomials = typename Flavor::ProverPolynomials;
+using Utils = barretenberg::RelationUtils<Flavor>;
+using RelationEvaluations = typename Flavor::TupleOfArraysOfValues;
+
+// The relations cost the same whatever the values, so a random arithmetic progression per polynomial will do, and is
+// much faster to build than random values at the larger sizes
+ProverPolynomials random_polynomials(size_t size)
+{
+    ProverPolynomials polynomials;
+    for (auto& polynomial : polynomials.get_all()) {
+        polynomial = typename Flavor::Polynomial(size);
+        FF value = FF::random_element(&engine);
+        const FF step = FF::random_element(&engine);
+        for (auto& coeff : polynomial) {
+            coeff = value;
+            value += step;
+        }
+    }
+    return polynomials;
+}
+
+// Evaluates all relations of the flavor at every row, as in the full Honk evaluations of ProtoGalaxy
+FF accumulate_row(const AllValues& row, const RelationParameters<FF>& params)
+{
+    RelationEvaluations evaluations;
+    Utils::zero_elements(evaluations);
+    Utils::template accumulate_relation_evaluations<>(row, evaluations, params, FF(1));
+    auto running_challenge = FF(1);
+    auto output = FF(0);
+    Utils::scale_and_batch_elements(evaluations, FF(2), running_challenge, output);
+    return output;
+}
+
+// Gathers every row from the column-major polynomials with get_row
+void column_major(::benchmark::State& state) noexcept
+{
+    const size_t size = 1UL << static_cast<size_t>(state.range(0));
+    auto polynomials = random_polynomials(size);
+    auto params = RelationParameters<FF>::get_random();
+    for (auto _ : state) {
+        FF sum = 0;
+        for (size_t row = 0; row < size; ++row) {
+            sum += accumulate_row(polynomials.get_row(row), params);
+        }
+        ::benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(column_major)->DenseRange(12, 18, 2)->Unit(::benchmark::kMillisecond);
+
+// Transposes the polynomials into row-major blocks, then evaluates the rows of each block
+void row_major_blocks(::benchmark::State& state) noexcept
+{
+    const size_t size = 1UL << static_cast<size_t>(state.range(0));
+    auto polynomials = random_polynomials(size);
+    auto params = RelationParameters<FF>::get_random();
+    honk::flavor::RowBlock<AllValues> row_block;
+    for (auto _ : state) {
+        FF sum = 0;
+        for (size_t start = 0; start < size; start += row_block.capacity()) {
+            row_block.load(polynomials, start, std::min(row_block.capacity(), size - start));
+            for (size_t i = 0; i < row_block.size(); ++i) {
+                sum += accumulate_row(row_block[i], params);
+            }
+        }
+        ::benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(row_major_blocks)->DenseRange(12, 18, 2)->Unit(::benchmark::kMillisecond);
+
+// The layouts alone: only read every value of every row
+void column_major_gather(::benchmark::State& state) noexcept
+{
+    const size_t size = 1UL << static_cast<size_t>(state.range(0));
+    auto polynomials = random_polynomials(size);
+    for (auto _ : state) {
+        FF sum = 0;
+        for (size_t row = 0; row < size; ++row) {
+            auto values = polynomials.get_row(row);
+            sum += values.w_l + values.z_perm_shift;
+        }
+        ::benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(column_major_gather)->DenseRange(12, 18, 2)->Unit(::benchmark::kMillisecond);
+
+void row_major_blocks_gather(::benchmark::State& state) noexcept
+{
+    const size_t size = 1UL << static_cast<size_t>(state.range(0));
+    auto polynomials = random_polynomials(size);
+    honk::flavor::RowBlock<AllValues> row_block;
+    for (auto _ : state) {
+        FF sum = 0;
+        for (size_t start = 0; start < size; start += row_block.capacity()) {
+            row_block.load(polynomials, start, std::min(row_block.capacity(), size - start));
+            for (size_t i = 0; i < row_block.size(); ++i) {
+                sum += row_block[i].w_l + row_block[i].z_perm_shift;
+            }
+        }
+        ::benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(row_major_blocks_gather)->DenseRange(12, 18, 2)->Unit(::benchmark::kMillisecond);
+
+} // namespace proof_system::benchmark::row_block
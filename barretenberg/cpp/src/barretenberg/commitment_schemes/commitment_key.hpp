@@ -10,6 +10,7 @@
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_point_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
@@ -21,6 +22,7 @@
 #include <cstddef>
 #include <memory>
 #include <string_view>
+#include <vector>
 
 namespace proof_system::honk::pcs {
 
@@ -70,12 +72,155 @@ template <class Curve> class CommitmentKey {
     {
         const size_t degree = polynomial.size();
         ASSERT(degree <= srs->get_monomial_size());
+        if (fixed_base_table != nullptr && degree <= fixed_base_table->num_points) {
+            return barretenberg::scalar_multiplication::pippenger_fixed_base<Curve>(
+                const_cast<Fr*>(polynomial.data()), *fixed_base_table, degree, pippenger_runtime_state);
+        }
         return barretenberg::scalar_multiplication::pippenger_unsafe<Curve>(
             const_cast<Fr*>(polynomial.data()), srs->get_monomial_points(), degree, pippenger_runtime_state);
     };
 
+    /**
+     * @brief Efficiently commit to a polynomial whose coefficients are mostly zero (or one)
+     *
+     * @details Only the non-trivial coefficients go through pippenger, so the cost is proportional to the number of
+     * coefficients not in {0, 1} rather than to the size of the polynomial. Not worth it for dense polynomials.
+     *
+     * @param polynomial a univariate polynomial p(X) = ∑ᵢ aᵢ⋅Xⁱ
+     * @return Commitment computed as C = [p(x)] = ∑ᵢ aᵢ⋅Gᵢ
+     */
+    Commitment commit_sparse(std::span<const Fr> polynomial)
+    {
+        const size_t degree = polynomial.size();
+        ASSERT(degree <= srs->get_monomial_size());
+        return barretenberg::scalar_multiplication::pippenger_sparse_unsafe<Curve>(
+            const_cast<Fr*>(polynomial.data()), srs->get_monomial_points(), degree, pippenger_runtime_state);
+    };
+
+    /**
+     * @brief Commit to a polynomial, skipping the zero coefficients outside of its active range
+     *
+     * @details The MSM runs over the active range [start, end) and the matching slice of the SRS only, so it costs
+     * end - start rather than the size of the polynomial. The fixed-base table only covers slices starting at the first
+     * point, so with one the MSM covers [0, end).
+     */
+    Commitment commit(const barretenberg::Polynomial<Fr>& polynomial)
+    {
+        const size_t start = polynomial.start_index();
+        const size_t end = polynomial.end_index();
+        ASSERT(end <= srs->get_monomial_size());
+        if (start == 0 || (fixed_base_table != nullptr && end <= fixed_base_table->num_points)) {
+            return commit(std::span<const Fr>(polynomial).first(end));
+        }
+        // the SRS holds two points per monomial, see the class description
+        return barretenberg::scalar_multiplication::pippenger_unsafe<Curve>(const_cast<Fr*>(&polynomial[start]),
+                                                                            srs->get_monomial_points() + 2 * start,
+                                                                            end - start,
+                                                                            pippenger_runtime_state);
+    };
+
+    /**
+     * @brief As commit_sparse on a span, over the polynomial's active range only
+     */
+    Commitment commit_sparse(const barretenberg::Polynomial<Fr>& polynomial)
+    {
+        const size_t start = polynomial.start_index();
+        const size_t end = polynomial.end_index();
+        ASSERT(end <= srs->get_monomial_size());
+        return barretenberg::scalar_multiplication::pippenger_sparse_unsafe<Curve>(
+            const_cast<Fr*>(&polynomial[start]),
+            srs->get_monomial_points() + 2 * start,
+            end - start,
+            pippenger_runtime_state);
+    };
+
+    /**
+     * @brief Commit to several polynomials at once
+     *
+     * @details The MSMs share one pippenger run where they fit into a common runtime state, so that threads are split
+     * across all of them rather than synchronising once per commitment. Polynomials that are too large to be batched
+     * are committed to one at a time.
+     *
+     * @param polynomials univariate polynomials p₀(X), p₁(X), ...
+     * @return Commitments [p₀(x)], [p₁(x)], ... in the same order
+     */
+    std::vector<Commitment> commit_batch(std::span<const std::span<const Fr>> polynomials)
+    {
+        std::vector<Commitment> commitments(polynomials.size());
+        // the fixed-base table already saves more than batching, and a single polynomial has nothing to share
+        if (fixed_base_table != nullptr || polynomials.size() < 2) {
+            for (size_t i = 0; i < polynomials.size(); ++i) {
+                commitments[i] = commit(polynomials[i]);
+            }
+            return commitments;
+        }
+
+        std::vector<std::span<const Fr>> batch;
+        std::vector<size_t> batch_indices;
+        size_t batch_size = 0;
+        for (size_t i = 0; i < polynomials.size(); ++i) {
+            ASSERT(polynomials[i].size() <= srs->get_monomial_size());
+            if (2 * polynomials[i].size() <= MAX_BATCH_SIZE) {
+                batch.push_back(polynomials[i]);
+                batch_indices.push_back(i);
+                batch_size += polynomials[i].size();
+            } else {
+                commitments[i] = commit(polynomials[i]);
+            }
+        }
+        if (batch.size() < 2) {
+            for (const size_t i : batch_indices) {
+                commitments[i] = commit(polynomials[i]);
+            }
+            return commitments;
+        }
+
+        // Use our own runtime state if the whole batch fits into it, otherwise (re)allocate a dedicated one
+        auto* state = &pippenger_runtime_state;
+        if (batch_size > static_cast<size_t>(pippenger_runtime_state.num_points / 2)) {
+            batch_size = std::min(batch_size, MAX_BATCH_SIZE);
+            if (batch_runtime_state == nullptr ||
+                static_cast<size_t>(batch_runtime_state->num_points / 2) < batch_size) {
+                batch_runtime_state =
+                    std::make_unique<barretenberg::scalar_multiplication::pippenger_runtime_state<Curve>>(batch_size);
+            }
+            state = batch_runtime_state.get();
+        }
+        const auto results = barretenberg::scalar_multiplication::pippenger_batch_unsafe<Curve>(
+            batch, srs->get_monomial_points(), *state);
+        for (size_t k = 0; k < batch_indices.size(); ++k) {
+            commitments[batch_indices[k]] = results[k];
+        }
+        return commitments;
+    };
+
+    /**
+     * @brief Precompute a fixed-base point table for the SRS, so that subsequent calls to commit() need fewer
+     * pippenger rounds
+     *
+     * @param memory_budget The maximum size of the table in bytes
+     * @return false if the budget is too small for the table to pay off, in which case commit() is unchanged
+     */
+    bool enable_fixed_base_msm(const size_t memory_budget)
+    {
+        const size_t num_points =
+            std::min(static_cast<size_t>(pippenger_runtime_state.num_points / 2), srs->get_monomial_size());
+        fixed_base_table = std::make_shared<barretenberg::scalar_multiplication::fixed_base_point_table<Curve>>(
+            srs->get_monomial_points(), num_points, memory_budget);
+        if (fixed_base_table->empty()) {
+            fixed_base_table = nullptr;
+            return false;
+        }
+        return true;
+    }
+
+    // The largest total number of points we allocate a dedicated batch runtime state for
+    static constexpr size_t MAX_BATCH_SIZE = 1UL << 18;
+
     barretenberg::scalar_multiplication::pippenger_runtime_state<Curve> pippenger_runtime_state;
     std::shared_ptr<barretenberg::srs::factories::ProverCrs<Curve>> srs;
+    std::shared_ptr<barretenberg::scalar_multiplication::fixed_base_point_table<Curve>> fixed_base_table;
+    std::unique_ptr<barretenberg::scalar_multiplication::pippenger_runtime_state<Curve>> batch_runtime_state;
 };
 
 } // namespace proof_system::honk::pcs
@@ -2,10 +2,15 @@
 #include "barretenberg/commitment_schemes/claim.hpp"
 #include "barretenberg/commitment_schemes/verification_key.hpp"
 #include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/thread_utils.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/transcript/transcript.hpp"
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <numeric>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -23,9 +28,19 @@ template <typename Curve> class IPA {
     using VK = VerifierCommitmentKey<Curve>;
     using Polynomial = barretenberg::Polynomial<Fr>;
 
+    // Minimum number of pairs folded by each thread in a round
+    static constexpr size_t MIN_ROUND_SIZE = 1 << 4;
+
   public:
     /**
      * @brief Compute an inner product argument proof for opening a single polynomial at a single evaluation point
+     * @details Each round's work is split across threads: the inner products, the folding of a, b and G (in place, in
+     * scratch vectors allocated once), and the two MSMs for L_i and R_i, which are computed by one batched pippenger
+     * call over the point table of G.
+     *
+     * G is folded as G_lo * u^{-1} + G_hi * u = u^{-1} * (G_lo + u^2 * G_hi). We only store G_lo + u^2 * G_hi, which is
+     * a single batched scalar multiplication per pair of points, and track the product of the u^{-1} factors, which
+     * scales the results of the MSMs instead.
      *
      * @param ck The commitment key containing srs and pippenger_runtime_state for computing MSM
      * @param opening_pair (challenge, evaluation)
@@ -50,13 +65,13 @@ template <typename Curve> class IPA {
                "The poly_degree should be positive and a power of two");
 
         auto a_vec = polynomial;
-        auto srs_elements = ck->srs->get_monomial_points();
+        auto* srs_elements = ck->srs->get_monomial_points();
         std::vector<Commitment> G_vec_local(poly_degree);
         // The SRS stored in the commitment key is the result after applying the pippenger point table so the
         // values at odd indices contain the point {srs[i-1].x * beta, srs[i-1].y}, where beta is the endomorphism
         // G_vec_local should use only the original SRS thus we extract only the even indices.
-        for (size_t i = 0; i < poly_degree * 2; i += 2) {
-            G_vec_local[i >> 1] = srs_elements[i];
+        for (size_t i = 0; i < poly_degree; i++) {
+            G_vec_local[i] = srs_elements[i * 2];
         }
         std::vector<Fr> b_vec(poly_degree);
         Fr b_power = 1;
@@ -70,31 +85,49 @@ template <typename Curve> class IPA {
         std::vector<GroupElement> R_elements(log_poly_degree);
         std::size_t round_size = poly_degree;
 
-        // TODO(#479): restructure IPA so it can be integrated with the pthread alternative to work queue (or even the
-        // work queue itself). Investigate whether parallelising parts of each rounds of IPA rounds brings significant
-        // improvements and see if reducing the size of G_vec_local and b_vec by taking the first iteration out of the
-        // loop can also be integrated.
+        // The first round's MSMs run over the SRS's own point table, later rounds over the point table of the folded G
+        Commitment* point_table = srs_elements;
+        std::vector<Commitment> G_table(poly_degree);
+        std::vector<GroupElement> G_sums(poly_degree / 2);
+        // G_vec_local * G_scale is the actual folded G
+        Fr G_scale = Fr::one();
+
         for (size_t i = 0; i < log_poly_degree; i++) {
             round_size >>= 1;
+            const size_t num_threads = barretenberg::thread_utils::calculate_num_threads(round_size, MIN_ROUND_SIZE);
+            const size_t iterations_per_thread = round_size / num_threads;
+            const auto thread_range = [&](size_t thread_idx) {
+                const size_t start = thread_idx * iterations_per_thread;
+                const size_t end = (thread_idx == num_threads - 1) ? round_size : start + iterations_per_thread;
+                return std::make_pair(start, end);
+            };
+
             // Compute inner_prod_L := < a_vec_lo, b_vec_hi > and inner_prod_R := < a_vec_hi, b_vec_lo >
+            std::vector<Fr> thread_inner_prods_L(num_threads, Fr::zero());
+            std::vector<Fr> thread_inner_prods_R(num_threads, Fr::zero());
+            parallel_for(num_threads, [&](size_t thread_idx) {
+                const auto [start, end] = thread_range(thread_idx);
+                for (size_t j = start; j < end; j++) {
+                    thread_inner_prods_L[thread_idx] += a_vec[j] * b_vec[round_size + j];
+                    thread_inner_prods_R[thread_idx] += a_vec[round_size + j] * b_vec[j];
+                }
+            });
             Fr inner_prod_L = Fr::zero();
             Fr inner_prod_R = Fr::zero();
-            for (size_t j = 0; j < round_size; j++) {
-                inner_prod_L += a_vec[j] * b_vec[round_size + j];
-                inner_prod_R += a_vec[round_size + j] * b_vec[j];
+            for (size_t thread_idx = 0; thread_idx < num_threads; thread_idx++) {
+                inner_prod_L += thread_inner_prods_L[thread_idx];
+                inner_prod_R += thread_inner_prods_R[thread_idx];
             }
-            // L_i = < a_vec_lo, G_vec_hi > + inner_prod_L * aux_generator
-            L_elements[i] =
-                // TODO(#473)
-                barretenberg::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-                    &a_vec[0], &G_vec_local[round_size], round_size, ck->pippenger_runtime_state);
-            L_elements[i] += aux_generator * inner_prod_L;
 
+            // L_i = < a_vec_lo, G_vec_hi > + inner_prod_L * aux_generator
             // R_i = < a_vec_hi, G_vec_lo > + inner_prod_R * aux_generator
-            // TODO(#473)
-            R_elements[i] = barretenberg::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-                &a_vec[round_size], &G_vec_local[0], round_size, ck->pippenger_runtime_state);
-            R_elements[i] += aux_generator * inner_prod_R;
+            const std::array<std::span<const Fr>, 2> msm_scalars{ std::span<const Fr>(&a_vec[0], round_size),
+                                                                  std::span<const Fr>(&a_vec[round_size], round_size) };
+            const std::array<size_t, 2> msm_point_offsets{ round_size, 0 };
+            const auto LR_sums = barretenberg::scalar_multiplication::pippenger_batch_unsafe<Curve>(
+                msm_scalars, point_table, ck->pippenger_runtime_state, msm_point_offsets);
+            L_elements[i] = LR_sums[0] * G_scale + aux_generator * inner_prod_L;
+            R_elements[i] = LR_sums[1] * G_scale + aux_generator * inner_prod_R;
 
             std::string index = std::to_string(i);
             transcript->send_to_verifier("IPA:L_" + index, Commitment(L_elements[i]));
@@ -103,24 +136,40 @@ template <typename Curve> class IPA {
             // Generate the round challenge.
             const Fr round_challenge = transcript->get_challenge("IPA:round_challenge_" + index);
             const Fr round_challenge_inv = round_challenge.invert();
-
-            std::vector<Commitment> G_lo(G_vec_local.begin(), G_vec_local.begin() + static_cast<long>(round_size));
-            std::vector<Commitment> G_hi(G_vec_local.begin() + static_cast<long>(round_size), G_vec_local.end());
-            G_lo = GroupElement::batch_mul_with_endomorphism(G_lo, round_challenge_inv);
-            G_hi = GroupElement::batch_mul_with_endomorphism(G_hi, round_challenge);
+            const Fr round_challenge_sqr = round_challenge.sqr();
+            // G is not used after the last round
+            const bool fold_G = i < log_poly_degree - 1;
 
             // Update the vectors a_vec, b_vec and G_vec.
             // a_vec_next = a_vec_lo * round_challenge + a_vec_hi * round_challenge_inv
             // b_vec_next = b_vec_lo * round_challenge_inv + b_vec_hi * round_challenge
-            // G_vec_next = G_vec_lo * round_challenge_inv + G_vec_hi * round_challenge
-            for (size_t j = 0; j < round_size; j++) {
-                a_vec[j] *= round_challenge;
-                a_vec[j] += round_challenge_inv * a_vec[round_size + j];
-                b_vec[j] *= round_challenge_inv;
-                b_vec[j] += round_challenge * b_vec[round_size + j];
-
-                G_vec_local[j] = G_lo[j] + G_hi[j];
-            }
+            // G_vec_next = G_vec_lo + G_vec_hi * round_challenge^2, and G_scale_next = G_scale * round_challenge_inv
+            parallel_for(num_threads, [&](size_t thread_idx) {
+                const auto [start, end] = thread_range(thread_idx);
+                for (size_t j = start; j < end; j++) {
+                    a_vec[j] *= round_challenge;
+                    a_vec[j] += round_challenge_inv * a_vec[round_size + j];
+                    b_vec[j] *= round_challenge_inv;
+                    b_vec[j] += round_challenge * b_vec[round_size + j];
+                }
+                if (!fold_G) {
+                    return;
+                }
+                const auto G_hi = GroupElement::batch_mul_with_endomorphism(
+                    std::span<const Commitment>(&G_vec_local[round_size + start], end - start), round_challenge_sqr);
+                for (size_t j = start; j < end; j++) {
+                    G_sums[j] = GroupElement(G_vec_local[j]) + G_hi[j - start];
+                }
+                GroupElement::batch_normalize(&G_sums[start], end - start);
+                for (size_t j = start; j < end; j++) {
+                    G_vec_local[j] = G_sums[j].is_point_at_infinity() ? Commitment::infinity()
+                                                                       : Commitment(G_sums[j].x, G_sums[j].y);
+                }
+                barretenberg::scalar_multiplication::generate_pippenger_point_table<Curve>(
+                    &G_vec_local[start], &G_table[start * 2], end - start);
+            });
+            G_scale *= round_challenge_inv;
+            point_table = &G_table[0];
         }
 
         transcript->send_to_verifier("IPA:a_0", a_vec[0]);
@@ -139,37 +188,120 @@ template <typename Curve> class IPA {
                        const OpeningClaim<Curve>& opening_claim,
                        const std::shared_ptr<BaseTranscript>& transcript)
     {
-        auto poly_degree = static_cast<size_t>(transcript->template receive_from_prover<uint64_t>("IPA:poly_degree"));
-        const Fr generator_challenge = transcript->get_challenge("IPA:generator_challenge");
-        auto aux_generator = Commitment::one() * generator_challenge;
+        return batch_verify(vk, { &opening_claim, 1 }, { &transcript, 1 });
+    }
 
-        auto log_poly_degree = static_cast<size_t>(numeric::get_msb(poly_degree));
+    /**
+     * @brief Verify several opening proofs at once
+     * @details The verification equation of each proof is
+     *
+     * C_zero - a_zero * G_zero - a_zero * b_zero * aux_generator = 0, where
+     * C_zero = C + evaluation * aux_generator + ∑_{j ∈ [k]} u_j^2L_j + ∑_{j ∈ [k]} u_j^{-2}R_j
+     * G_zero = < s_vec, G_vec >.
+     *
+     * We take a random linear combination of the equations (the first one with weight 1, so verifying a single proof
+     * is deterministic) and check it with a single MSM, in which the G_vec terms of all proofs share their points.
+     *
+     * @param opening_claims The claims, which may have different degrees
+     * @param transcripts The transcript holding the proof of each claim
+     *
+     * @return true/false depending on if all the proofs verify
+     */
+    static bool batch_verify(const std::shared_ptr<VK>& vk,
+                             std::span<const OpeningClaim<Curve>> opening_claims,
+                             std::span<const std::shared_ptr<BaseTranscript>> transcripts)
+    {
+        ASSERT(!opening_claims.empty() && opening_claims.size() == transcripts.size());
+        const size_t num_claims = opening_claims.size();
+        const size_t srs_size = vk->srs->get_monomial_size();
 
-        // Compute C_prime
-        GroupElement C_prime = opening_claim.commitment + (aux_generator * opening_claim.opening_pair.evaluation);
+        std::vector<RoundData> rounds(num_claims);
+        size_t max_poly_degree = 0;
+        size_t num_other_points = 1;
+        for (size_t k = 0; k < num_claims; k++) {
+            rounds[k] = receive_rounds(*transcripts[k]);
+            const size_t poly_degree = rounds[k].poly_degree;
+            if (poly_degree == 0 || (poly_degree & (poly_degree - 1)) != 0 || poly_degree > srs_size) {
+                return false;
+            }
+            max_poly_degree = std::max(max_poly_degree, poly_degree);
+            num_other_points += 1 + 2 * rounds[k].round_challenges.size();
+        }
 
-        // Compute C_zero = C_prime + ∑_{j ∈ [k]} u_j^2L_j + ∑_{j ∈ [k]} u_j^{-2}R_j
-        auto pippenger_size = 2 * log_poly_degree;
-        std::vector<Fr> round_challenges(log_poly_degree);
-        std::vector<Fr> round_challenges_inv(log_poly_degree);
-        std::vector<Commitment> msm_elements(pippenger_size);
-        std::vector<Fr> msm_scalars(pippenger_size);
-        for (size_t i = 0; i < log_poly_degree; i++) {
-            std::string index = std::to_string(i);
-            auto element_L = transcript->template receive_from_prover<Commitment>("IPA:L_" + index);
-            auto element_R = transcript->template receive_from_prover<Commitment>("IPA:R_" + index);
-            round_challenges[i] = transcript->get_challenge("IPA:round_challenge_" + index);
-            round_challenges_inv[i] = round_challenges[i].invert();
-
-            msm_elements[2 * i] = element_L;
-            msm_elements[2 * i + 1] = element_R;
-            msm_scalars[2 * i] = round_challenges[i].sqr();
-            msm_scalars[2 * i + 1] = round_challenges_inv[i].sqr();
+        // The MSM is over G_vec followed by the generator, and the commitment, L_j and R_j of each proof
+        const size_t msm_size = max_poly_degree + num_other_points;
+        std::vector<Fr> msm_scalars(msm_size, Fr::zero());
+        std::vector<Commitment> other_points;
+        other_points.reserve(num_other_points);
+        other_points.emplace_back(Commitment::one());
+        Fr* other_scalars = &msm_scalars[max_poly_degree];
+        size_t other_idx = 1;
+
+        std::vector<Fr> G_factors(num_claims);
+        for (size_t k = 0; k < num_claims; k++) {
+            const RoundData& round = rounds[k];
+            const Fr batching_scalar = (k == 0) ? Fr::one() : Fr::random_element();
+            const Fr& evaluation = opening_claims[k].opening_pair.evaluation;
+            const Fr b_zero = round.compute_b_zero(opening_claims[k].opening_pair.challenge);
+
+            other_scalars[0] += batching_scalar * round.generator_challenge * (evaluation - round.a_zero * b_zero);
+            other_points.emplace_back(opening_claims[k].commitment);
+            other_scalars[other_idx++] = batching_scalar;
+            for (size_t j = 0; j < round.round_challenges.size(); j++) {
+                other_points.emplace_back(round.L[j]);
+                other_scalars[other_idx++] = batching_scalar * round.round_challenges[j].sqr();
+                other_points.emplace_back(round.R[j]);
+                other_scalars[other_idx++] = batching_scalar * round.round_challenges_inv[j].sqr();
+            }
+            G_factors[k] = -(batching_scalar * round.a_zero);
+        }
+
+        // The G_vec scalars of (one of) the largest proofs are written in place, those of the others are added to them
+        const auto is_full = [&](const RoundData& round) { return round.poly_degree == max_poly_degree; };
+        const auto first_full_claim =
+            static_cast<size_t>(std::find_if(rounds.begin(), rounds.end(), is_full) - rounds.begin());
+        compute_s_vec(rounds[first_full_claim], G_factors[first_full_claim], { &msm_scalars[0], max_poly_degree });
+        std::vector<Fr> s_vec;
+        for (size_t k = 0; k < num_claims; k++) {
+            if (k == first_full_claim) {
+                continue;
+            }
+            const size_t poly_degree = rounds[k].poly_degree;
+            s_vec.resize(poly_degree);
+            compute_s_vec(rounds[k], G_factors[k], s_vec);
+            const size_t num_threads = barretenberg::thread_utils::calculate_num_threads_pow2(poly_degree);
+            const size_t chunk_size = poly_degree / num_threads;
+            parallel_for(num_threads, [&](size_t thread_idx) {
+                for (size_t i = thread_idx * chunk_size; i < (thread_idx + 1) * chunk_size; i++) {
+                    msm_scalars[i] += s_vec[i];
+                }
+            });
         }
-        // TODO(#473)
-        GroupElement LR_sums = barretenberg::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-            &msm_scalars[0], &msm_elements[0], pippenger_size, vk->pippenger_runtime_state);
-        GroupElement C_zero = C_prime + LR_sums;
+
+        // The SRS stored in the commitment key is already the pippenger point table of G_vec, so we copy it as it is
+        // and only compute the table of the other points.
+        std::vector<Commitment> msm_points(msm_size * 2);
+        const auto* srs_elements = vk->srs->get_monomial_points();
+        std::copy(srs_elements, srs_elements + max_poly_degree * 2, msm_points.begin());
+        barretenberg::scalar_multiplication::generate_pippenger_point_table<Curve>(
+            &other_points[0], &msm_points[max_poly_degree * 2], num_other_points);
+
+        // The points come from the prover, so they may coincide with each other
+        GroupElement result = barretenberg::scalar_multiplication::pippenger<Curve>(
+            &msm_scalars[0], &msm_points[0], msm_size, vk->pippenger_runtime_state, true);
+        return result.is_point_at_infinity();
+    }
+
+  private:
+    // The messages of one proof and the challenges derived from them
+    struct RoundData {
+        size_t poly_degree;
+        Fr generator_challenge;
+        std::vector<Fr> round_challenges;
+        std::vector<Fr> round_challenges_inv;
+        std::vector<Commitment> L;
+        std::vector<Commitment> R;
+        Fr a_zero;
 
         /**
          * Compute b_zero where b_zero can be computed using the polynomial:
@@ -178,47 +310,75 @@ template <typename Curve> class IPA {
          *
          * b_zero = g(evaluation) = ∏_{i ∈ [k]} (u_{k-i}^{-1} + u_{k-i}. (evaluation)^{2^{i-1}})
          */
-        Fr b_zero = Fr::one();
+        Fr compute_b_zero(const Fr& challenge) const
+        {
+            const size_t log_poly_degree = round_challenges.size();
+            Fr b_zero = Fr::one();
+            Fr challenge_power = challenge;
+            for (size_t i = 0; i < log_poly_degree; i++) {
+                b_zero *= round_challenges_inv[log_poly_degree - 1 - i] +
+                          (round_challenges[log_poly_degree - 1 - i] * challenge_power);
+                challenge_power.self_sqr();
+            }
+            return b_zero;
+        }
+    };
+
+    static RoundData receive_rounds(BaseTranscript& transcript)
+    {
+        RoundData round;
+        round.poly_degree = static_cast<size_t>(transcript.template receive_from_prover<uint64_t>("IPA:poly_degree"));
+        round.generator_challenge = transcript.get_challenge("IPA:generator_challenge");
+        const size_t log_poly_degree =
+            round.poly_degree == 0 ? 0 : static_cast<size_t>(numeric::get_msb(uint64_t(round.poly_degree)));
+        round.round_challenges.resize(log_poly_degree);
+        round.L.resize(log_poly_degree);
+        round.R.resize(log_poly_degree);
         for (size_t i = 0; i < log_poly_degree; i++) {
-            auto exponent = static_cast<uint64_t>(Fr(2).pow(i));
-            b_zero *= round_challenges_inv[log_poly_degree - 1 - i] +
-                      (round_challenges[log_poly_degree - 1 - i] * opening_claim.opening_pair.challenge.pow(exponent));
+            std::string index = std::to_string(i);
+            round.L[i] = transcript.template receive_from_prover<Commitment>("IPA:L_" + index);
+            round.R[i] = transcript.template receive_from_prover<Commitment>("IPA:R_" + index);
+            round.round_challenges[i] = transcript.get_challenge("IPA:round_challenge_" + index);
         }
+        round.round_challenges_inv = round.round_challenges;
+        Fr::batch_invert(round.round_challenges_inv);
+        round.a_zero = transcript.template receive_from_prover<Fr>("IPA:a_0");
+        return round;
+    }
 
-        // Compute G_zero
-        // First construct s_vec
-        std::vector<Fr> s_vec(poly_degree);
-        for (size_t i = 0; i < poly_degree; i++) {
-            Fr s_vec_scalar = Fr::one();
-            for (size_t j = (log_poly_degree - 1); j != size_t(-1); j--) {
-                auto bit = (i >> j) & 1;
-                bool b = static_cast<bool>(bit);
-                if (b) {
-                    s_vec_scalar *= round_challenges[log_poly_degree - 1 - j];
-                } else {
-                    s_vec_scalar *= round_challenges_inv[log_poly_degree - 1 - j];
+    /**
+     * @brief Compute factor * s_vec, where s_vec[i] = ∏_{j ∈ [k]} u_{k-1-j}^{±1}, the sign being that of bit j of i
+     * @details Setting a bit j that is clear in i multiplies s_vec[i] by u_{k-1-j}^2. Each thread takes an aligned
+     * chunk of s_vec, computes its first element directly, and doubles the filled prefix of the chunk once per low bit,
+     * so the vector costs one multiplication per element.
+     */
+    static void compute_s_vec(const RoundData& round, const Fr& factor, std::span<Fr> s_vec)
+    {
+        const size_t log_poly_degree = round.round_challenges.size();
+        const size_t poly_degree = s_vec.size();
+        std::vector<Fr> round_challenges_sqr(log_poly_degree);
+        for (size_t j = 0; j < log_poly_degree; j++) {
+            round_challenges_sqr[j] = round.round_challenges[j].sqr();
+        }
+        const size_t num_threads = barretenberg::thread_utils::calculate_num_threads_pow2(poly_degree, MIN_ROUND_SIZE);
+        const size_t chunk_size = poly_degree / num_threads;
+        const auto log_chunk_size = static_cast<size_t>(numeric::get_msb(static_cast<uint64_t>(chunk_size)));
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = thread_idx * chunk_size;
+            Fr s_vec_scalar = factor;
+            for (size_t j = 0; j < log_poly_degree; j++) {
+                s_vec_scalar *= ((start >> j) & 1) ? round.round_challenges[log_poly_degree - 1 - j]
+                                                   : round.round_challenges_inv[log_poly_degree - 1 - j];
+            }
+            s_vec[start] = s_vec_scalar;
+            for (size_t j = 0; j < log_chunk_size; j++) {
+                const size_t half = size_t(1) << j;
+                const Fr& u_sqr = round_challenges_sqr[log_poly_degree - 1 - j];
+                for (size_t i = 0; i < half; i++) {
+                    s_vec[start + half + i] = s_vec[start + i] * u_sqr;
                 }
             }
-            s_vec[i] = s_vec_scalar;
-        }
-        auto srs_elements = vk->srs->get_monomial_points();
-        // Copy the G_vector to local memory.
-        std::vector<Commitment> G_vec_local(poly_degree);
-        // The SRS stored in the commitment key is the result after applying the pippenger point table so the
-        // values at odd indices contain the point {srs[i-1].x * beta, srs[i-1].y}, where beta is the endomorphism
-        // G_vec_local should use only the original SRS thus we extract only the even indices.
-        for (size_t i = 0; i < poly_degree * 2; i += 2) {
-            G_vec_local[i >> 1] = srs_elements[i];
-        }
-        // TODO(#473)
-        auto G_zero = barretenberg::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-            &s_vec[0], &G_vec_local[0], poly_degree, vk->pippenger_runtime_state);
-
-        auto a_zero = transcript->template receive_from_prover<Fr>("IPA:a_0");
-
-        GroupElement right_hand_side = G_zero * a_zero + aux_generator * a_zero * b_zero;
-
-        return (C_zero.normalize() == right_hand_side.normalize());
+        });
     }
 };
 
@@ -82,6 +82,59 @@ TEST_F(IPATest, Open)
     EXPECT_EQ(prover_transcript->get_manifest(), verifier_transcript->get_manifest());
 }
 
+TEST_F(IPATest, OpenLarge)
+{
+    using IPA = IPA<Curve>;
+    // large enough for the rounds to be split across threads, with zero coefficients in the mix
+    size_t n = 4096;
+    auto poly = this->random_polynomial(n);
+    for (size_t i = 0; i < n; i += 3) {
+        poly[i] = Fr::zero();
+    }
+    auto [x, eval] = this->random_eval(poly);
+    auto commitment = this->commit(poly);
+    const OpeningPair<Curve> opening_pair = { x, eval };
+    const OpeningClaim<Curve> opening_claim{ opening_pair, commitment };
+
+    auto prover_transcript = std::make_shared<BaseTranscript>();
+    IPA::compute_opening_proof(this->ck(), opening_pair, poly, prover_transcript);
+
+    auto verifier_transcript = std::make_shared<BaseTranscript>(prover_transcript->proof_data);
+    auto result = IPA::verify(this->vk(), opening_claim, verifier_transcript);
+    EXPECT_TRUE(result);
+}
+
+TEST_F(IPATest, BatchVerify)
+{
+    using IPA = IPA<Curve>;
+    std::vector<OpeningClaim<Curve>> opening_claims;
+    std::vector<std::shared_ptr<BaseTranscript>> prover_transcripts;
+    for (size_t n : { 64UL, 1024UL, 2UL, 1024UL }) {
+        auto poly = this->random_polynomial(n);
+        auto [x, eval] = this->random_eval(poly);
+        const OpeningPair<Curve> opening_pair = { x, eval };
+        opening_claims.push_back({ opening_pair, this->commit(poly) });
+        prover_transcripts.push_back(std::make_shared<BaseTranscript>());
+        IPA::compute_opening_proof(this->ck(), opening_pair, poly, prover_transcripts.back());
+    }
+    auto verifier_transcripts = [&]() {
+        std::vector<std::shared_ptr<BaseTranscript>> transcripts;
+        for (auto& prover_transcript : prover_transcripts) {
+            transcripts.push_back(std::make_shared<BaseTranscript>(prover_transcript->proof_data));
+        }
+        return transcripts;
+    };
+
+    EXPECT_TRUE(IPA::batch_verify(this->vk(), opening_claims, verifier_transcripts()));
+
+    // A single wrong claim fails the batch
+    for (size_t i = 0; i < opening_claims.size(); i++) {
+        auto bad_claims = opening_claims;
+        bad_claims[i].opening_pair.evaluation += Fr::one();
+        EXPECT_FALSE(IPA::batch_verify(this->vk(), bad_claims, verifier_transcripts()));
+    }
+}
+
 TEST_F(IPATest, GeminiShplonkIPAWithShift)
 {
     using IPA = IPA<Curve>;
@@ -49,6 +49,24 @@ TYPED_TEST(KZGTest, single)
     EXPECT_EQ(verified, true);
 }
 
+TYPED_TEST(KZGTest, commit_active_range)
+{
+    using Fr = typename TypeParam::ScalarField;
+    using Polynomial = barretenberg::Polynomial<Fr>;
+    const size_t n = 64;
+
+    for (const auto& [start, end] : std::vector<std::pair<size_t, size_t>>{ { 0, 3 }, { 5, 40 }, { 63, 64 } }) {
+        Polynomial witness(n, start, end);
+        for (size_t i = start; i < end; ++i) {
+            witness[i] = Fr::random_element();
+        }
+        // committing to the span ignores the active range
+        auto expected = this->ck()->commit(std::span<const Fr>(witness));
+        EXPECT_EQ(this->ck()->commit(witness), expected);
+        EXPECT_EQ(this->ck()->commit_sparse(witness), expected);
+    }
+}
+
 /**
  * @brief Test full PCS protocol: Gemini, Shplonk, KZG and pairing check
  * @details Demonstrates the full PCS protocol as it is used in the construction and verification
@@ -1,6 +1,8 @@
 #pragma once
 #include "barretenberg/commitment_schemes/commitment_key.hpp"
 #include "barretenberg/common/ref_vector.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/thread_utils.hpp"
 #include "barretenberg/common/zip_view.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/transcript/transcript.hpp"
@@ -39,6 +41,48 @@ template <typename Curve> class ZeroMorphProver_ {
     // (Then, eventually, set it based on the real SRS). For now we set it to be large but more or less arbitrary.
     static const size_t N_max = 1 << 22;
 
+    // Coefficients are batched in blocks of this size, so that the block of the result stays in L1 while each of the
+    // input polynomials is added to it
+    static constexpr size_t BATCHING_BLOCK_SIZE = 1 << 10;
+
+    /**
+     * @brief Call func(start, end) on contiguous ranges of [0, size), in parallel
+     */
+    template <typename Func> static void parallel_for_ranges(size_t size, const Func& func)
+    {
+        const size_t num_threads = barretenberg::thread_utils::calculate_num_threads(size);
+        const size_t range_per_thread = size / num_threads;
+        const size_t leftovers = size - (range_per_thread * num_threads);
+        parallel_for(num_threads, [&](size_t j) {
+            const size_t start = j * range_per_thread;
+            const size_t end = (j == num_threads - 1) ? start + range_per_thread + leftovers : start + range_per_thread;
+            func(start, end);
+        });
+    }
+
+    /**
+     * @brief Set result = \sum_i scalars[i] * polynomials[i], in a single pass over the coefficients of result
+     * @details Polynomials shorter than result contribute zeros beyond their size.
+     */
+    static void batch_polynomials(Polynomial& result, RefVector<Polynomial> polynomials, std::span<const FF> scalars)
+    {
+        ASSERT(polynomials.size() <= scalars.size());
+        parallel_for_ranges(result.size(), [&](size_t start, size_t end) {
+            for (size_t block_start = start; block_start < end; block_start += BATCHING_BLOCK_SIZE) {
+                const size_t block_end = std::min(block_start + BATCHING_BLOCK_SIZE, end);
+                std::fill(&result[block_start], &result[0] + block_end, FF(0));
+                for (size_t i = 0; i < polynomials.size(); ++i) {
+                    const Polynomial& polynomial = polynomials[i];
+                    const FF& scalar = scalars[i];
+                    const size_t poly_end = std::min(block_end, polynomial.size());
+                    for (size_t idx = block_start; idx < poly_end; ++idx) {
+                        result[idx] += scalar * polynomial[idx];
+                    }
+                }
+            }
+        });
+    }
+
   public:
     /**
      * @brief Compute multivariate quotients q_k(X_0, ..., X_{k-1}) for f(X_0, ..., X_{n-1})
@@ -66,43 +110,26 @@ template <typename Curve> class ZeroMorphProver_ {
         // The size of the multilinear challenge must equal the log of the polynomial size
         ASSERT(log_N == u_challenge.size());
 
-        // Define the vector of quotients q_k, k = 0, ..., log_N-1
+        // Define the vector of quotients q_k, k = 0, ..., log_N-1. Every coefficient is written below.
         std::vector<Polynomial> quotients;
+        quotients.reserve(log_N);
         for (size_t k = 0; k < log_N; ++k) {
-            size_t size = 1 << k;
-            quotients.emplace_back(Polynomial(size)); // degree 2^k - 1
-        }
-
-        // Compute the coefficients of q_{n-1}
-        size_t size_q = 1 << (log_N - 1);
-        Polynomial q{ size_q };
-        for (size_t l = 0; l < size_q; ++l) {
-            q[l] = polynomial[size_q + l] - polynomial[l];
+            quotients.emplace_back(size_t(1) << k, barretenberg::DontZeroMemory::FLAG); // degree 2^k - 1
         }
 
-        quotients[log_N - 1] = q.share();
-
-        std::vector<FF> f_k;
-        f_k.resize(size_q);
-
-        std::vector<FF> g(polynomial.data().get(), polynomial.data().get() + size_q);
-
-        // Compute q_k in reverse order from k= n-2, i.e. q_{n-2}, ..., q_0
-        for (size_t k = 1; k < log_N; ++k) {
-            // Compute f_k
-            for (size_t l = 0; l < size_q; ++l) {
-                f_k[l] = g[l] + u_challenge[log_N - k] * q[l];
-            }
-
-            size_q = size_q / 2;
-            q = Polynomial{ size_q };
-
-            for (size_t l = 0; l < size_q; ++l) {
-                q[l] = f_k[size_q + l] - f_k[l];
-            }
-
-            quotients[log_N - k - 1] = q.share();
-            g = f_k;
+        // f is updated in place: once q_k is computed, the first 2^k coefficients of polynomial hold those of f_k. Each
+        // step reads f[l] and f[size_q + l] and writes q_k[l] and f[l] for the same l, so it splits freely across
+        // threads.
+        for (size_t k = log_N; k-- > 0;) {
+            const size_t size_q = size_t(1) << k;
+            const FF& u = u_challenge[k];
+            Polynomial& q = quotients[k];
+            parallel_for_ranges(size_q, [&](size_t start, size_t end) {
+                for (size_t l = start; l < end; ++l) {
+                    q[l] = polynomial[size_q + l] - polynomial[l];
+                    polynomial[l] += u * q[l];
+                }
+            });
         }
 
         return quotients;
@@ -124,23 +151,25 @@ template <typename Curve> class ZeroMorphProver_ {
                                                              FF y_challenge,
                                                              size_t N)
     {
+        size_t log_N = quotients.size();
+        auto y_powers = powers_of_challenge(y_challenge, log_N); // y^k
+
         // Batched lifted degree quotient polynomial
-        auto result = Polynomial(N);
-
-        // Compute \hat{q} = \sum_k y^k * X^{N - d_k - 1} * q_k
-        size_t k = 0;
-        auto scalar = FF(1); // y^k
-        for (auto& quotient : quotients) {
-            // Rather than explicitly computing the shifts of q_k by N - d_k - 1 (i.e. multiplying q_k by X^{N - d_k -
-            // 1}) then accumulating them, we simply accumulate y^k*q_k into \hat{q} at the index offset N - d_k - 1
-            auto deg_k = static_cast<size_t>((1 << k) - 1);
-            size_t offset = N - deg_k - 1;
-            for (size_t idx = 0; idx < deg_k + 1; ++idx) {
-                result[offset + idx] += scalar * quotient[idx];
+        auto result = Polynomial(N, barretenberg::DontZeroMemory::FLAG);
+
+        // Rather than explicitly computing the shifts of q_k by N - d_k - 1 (i.e. multiplying q_k by X^{N - d_k - 1})
+        // then accumulating them, we accumulate y^k*q_k into \hat{q} at the index offset N - d_k - 1 = N - 2^k. All the
+        // shifted q_k end at N - 1, so coefficient i of \hat{q} collects the q_k with 2^k >= N - i, which lets each
+        // thread compute its own range of coefficients.
+        parallel_for_ranges(N, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                FF coefficient(0);
+                for (size_t k = log_N; k-- > 0 && (size_t(1) << k) >= N - i;) {
+                    coefficient += y_powers[k] * quotients[k][i + (size_t(1) << k) - N];
+                }
+                result[i] = coefficient;
             }
-            scalar *= y_challenge; // update batching scalar y^k
-            k++;
-        }
+        });
 
         return result;
     }
@@ -165,20 +194,27 @@ template <typename Curve> class ZeroMorphProver_ {
         size_t N = batched_quotient.size();
         size_t log_N = quotients.size();
 
-        // Initialize partially evaluated degree check polynomial \zeta_x to \hat{q}
-        auto result = batched_quotient;
-
+        // Scalars y^k * x^{N - d_k - 1} of the q_k
+        std::vector<FF> scalars(log_N);
         auto y_power = FF(1); // y^k
         for (size_t k = 0; k < log_N; ++k) {
-            // Accumulate y^k * x^{N - d_k - 1} * q_k into \hat{q}
             auto deg_k = static_cast<size_t>((1 << k) - 1);
-            auto x_power = x_challenge.pow(N - deg_k - 1); // x^{N - d_k - 1}
-
-            result.add_scaled(quotients[k], -y_power * x_power);
-
+            scalars[k] = y_power * x_challenge.pow(N - deg_k - 1);
             y_power *= y_challenge; // update batching scalar y^k
         }
 
+        // \zeta_x = \hat{q} - \sum_k y^k * x^{N - d_k - 1} * q_k, where coefficient i collects the q_k with 2^k > i
+        auto result = Polynomial(N, barretenberg::DontZeroMemory::FLAG);
+        parallel_for_ranges(N, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                FF coefficient = batched_quotient[i];
+                for (size_t k = log_N; k-- > 0 && i < (size_t(1) << k);) {
+                    coefficient -= scalars[k] * quotients[k][i];
+                }
+                result[i] = coefficient;
+            }
+        });
+
         return result;
     }
 
@@ -214,50 +250,72 @@ template <typename Curve> class ZeroMorphProver_ {
         size_t N = f_batched.size();
         size_t log_N = quotients.size();
 
-        // Initialize Z_x with x * \sum_{i=0}^{m-1} f_i + \sum_{i=0}^{l-1} g_i
-        auto result = g_batched;
-        result.add_scaled(f_batched, x_challenge);
-
-        // Compute Z_x -= v * x * \Phi_n(x)
+        // x^{2^k} - 1 for k = 0, ..., log_N, inverted together as they are all divided by
+        std::vector<FF> x_powers(log_N + 1); // x^{2^k}
+        std::vector<FF> phi_denominators_inv(log_N + 1);
+        x_powers[0] = x_challenge;
+        for (size_t k = 0; k <= log_N; ++k) {
+            if (k > 0) {
+                x_powers[k] = x_powers[k - 1].sqr();
+            }
+            phi_denominators_inv[k] = x_powers[k] - 1;
+        }
+        FF::batch_invert(phi_denominators_inv);
         auto phi_numerator = x_challenge.pow(N) - 1; // x^N - 1
-        auto phi_n_x = phi_numerator / (x_challenge - 1);
-        result[0] -= v_evaluation * x_challenge * phi_n_x;
 
-        // Add contribution from q_k polynomials
-        auto x_power = x_challenge; // x^{2^k}
+        // Scalars of the q_k polynomials: -x * (x^{2^k} * \Phi_{n-k-1}(x^{2^{k+1}}) - u_k * \Phi_{n-k}(x^{2^k}))
+        std::vector<FF> quotient_scalars(log_N);
         for (size_t k = 0; k < log_N; ++k) {
-            x_power = x_challenge.pow(1 << k); // x^{2^k}
-
             // \Phi_{n-k-1}(x^{2^{k + 1}})
-            auto phi_term_1 = phi_numerator / (x_challenge.pow(1 << (k + 1)) - 1);
+            auto phi_term_1 = phi_numerator * phi_denominators_inv[k + 1];
 
             // \Phi_{n-k}(x^{2^k})
-            auto phi_term_2 = phi_numerator / (x_challenge.pow(1 << k) - 1);
+            auto phi_term_2 = phi_numerator * phi_denominators_inv[k];
 
             // x^{2^k} * \Phi_{n-k-1}(x^{2^{k+1}}) - u_k *  \Phi_{n-k}(x^{2^k})
-            auto scalar = x_power * phi_term_1 - u_challenge[k] * phi_term_2;
+            auto scalar = x_powers[k] * phi_term_1 - u_challenge[k] * phi_term_2;
 
             scalar *= x_challenge;
             scalar *= FF(-1);
-
-            result.add_scaled(quotients[k], scalar);
+            quotient_scalars[k] = scalar;
         }
 
         // If necessary, add to Z_x the contribution related to concatenated polynomials:
         // \sum_{i=0}^{num_chunks_per_group}(x^{i * min_n + 1}concatenation_groups_batched_{i}).
         // We are effectively reconstructing concatenated polynomials from their chunks now that we know x
         // Note: this is an implementation detail related to Goblin Translator and is not part of the standard protocol.
+        std::vector<FF> concatenation_scalars(concatenation_groups_batched.size());
         if (!concatenation_groups_batched.empty()) {
             size_t MINICIRCUIT_N = N / concatenation_groups_batched.size();
             auto x_to_minicircuit_N =
                 x_challenge.pow(MINICIRCUIT_N); // power of x used to shift polynomials to the right
             auto running_shift = x_challenge;
             for (size_t i = 0; i < concatenation_groups_batched.size(); i++) {
-                result.add_scaled(concatenation_groups_batched[i], running_shift);
+                concatenation_scalars[i] = running_shift;
                 running_shift *= x_to_minicircuit_N;
             }
         }
 
+        // Z_x = x * f_batched + g_batched + \sum_k scalar_k * q_k + concatenation term, in a single pass where
+        // coefficient i collects the q_k with 2^k > i
+        auto result = Polynomial(N, barretenberg::DontZeroMemory::FLAG);
+        parallel_for_ranges(N, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                FF coefficient = g_batched[i] + x_challenge * f_batched[i];
+                for (size_t k = log_N; k-- > 0 && i < (size_t(1) << k);) {
+                    coefficient += quotient_scalars[k] * quotients[k][i];
+                }
+                for (size_t j = 0; j < concatenation_groups_batched.size(); ++j) {
+                    coefficient += concatenation_scalars[j] * concatenation_groups_batched[j][i];
+                }
+                result[i] = coefficient;
+            }
+        });
+
+        // Compute Z_x -= v * x * \Phi_n(x)
+        auto phi_n_x = phi_numerator * phi_denominators_inv[0];
+        result[0] -= v_evaluation * x_challenge * phi_n_x;
+
         return result;
     }
 
@@ -316,14 +374,14 @@ template <typename Curve> class ZeroMorphProver_ {
      * @param commitment_key
      * @param transcript
      */
-    static void prove(const std::vector<Polynomial>& f_polynomials,
-                      const std::vector<Polynomial>& g_polynomials,
+    static void prove(RefVector<Polynomial> f_polynomials,
+                      RefVector<Polynomial> g_polynomials,
                       const std::vector<FF>& f_evaluations,
                       const std::vector<FF>& g_shift_evaluations,
                       const std::vector<FF>& multilinear_challenge,
                       const std::shared_ptr<CommitmentKey<Curve>>& commitment_key,
                       const std::shared_ptr<BaseTranscript>& transcript,
-                      const std::vector<Polynomial>& concatenated_polynomials = {},
+                      RefVector<Polynomial> concatenated_polynomials = {},
                       const std::vector<FF>& concatenated_evaluations = {},
                       const std::vector<RefVector<Polynomial>>& concatenation_groups = {})
     {
@@ -335,6 +393,15 @@ template <typename Curve> class ZeroMorphProver_ {
         size_t log_N = u_challenge.size();
         size_t N = 1 << log_N;
 
+        // Batching scalars \rho^i, used by the f_i, then the g_i, then the concatenated polynomials
+        const size_t num_f = f_polynomials.size();
+        const size_t num_g = g_polynomials.size();
+        const size_t num_groups = concatenation_groups.size();
+        const auto rho_powers = powers_of_challenge(rho, num_f + num_g + num_groups);
+        const std::span<const FF> f_scalars(&rho_powers[0], num_f);
+        const std::span<const FF> g_scalars(&rho_powers[num_f], num_g);
+        const std::span<const FF> concatenation_scalars(&rho_powers[num_f + num_g], num_groups);
+
         // Compute batching of unshifted polynomials f_i and to-be-shifted polynomials g_i:
         // f_batched = sum_{i=0}^{m-1}\rho^i*f_i and g_batched = sum_{i=0}^{l-1}\rho^{m+i}*g_i,
         // and also batched evaluation
@@ -342,56 +409,58 @@ template <typename Curve> class ZeroMorphProver_ {
         // Note: g_batched is formed from the to-be-shifted polynomials, but the batched evaluation incorporates the
         // evaluations produced by sumcheck of h_i = g_i_shifted.
         FF batched_evaluation{ 0 };
-        Polynomial f_batched(N); // batched unshifted polynomials
-        FF batching_scalar{ 1 };
-        for (auto [f_poly, f_eval] : zip_view(f_polynomials, f_evaluations)) {
-            f_batched.add_scaled(f_poly, batching_scalar);
-            batched_evaluation += batching_scalar * f_eval;
-            batching_scalar *= rho;
+        for (size_t i = 0; i < num_f; ++i) {
+            batched_evaluation += f_scalars[i] * f_evaluations[i];
+        }
+        for (size_t i = 0; i < num_g; ++i) {
+            batched_evaluation += g_scalars[i] * g_shift_evaluations[i];
+        }
+        for (size_t i = 0; i < num_groups; ++i) {
+            batched_evaluation += concatenation_scalars[i] * concatenated_evaluations[i];
         }
 
-        Polynomial g_batched{ N }; // batched to-be-shifted polynomials
-        for (auto [g_poly, g_shift_eval] : zip_view(g_polynomials, g_shift_evaluations)) {
-            g_batched.add_scaled(g_poly, batching_scalar);
-            batched_evaluation += batching_scalar * g_shift_eval;
-            batching_scalar *= rho;
-        };
+        Polynomial f_batched(N, barretenberg::DontZeroMemory::FLAG); // batched unshifted polynomials
+        batch_polynomials(f_batched, f_polynomials, f_scalars);
+        Polynomial g_batched(N, barretenberg::DontZeroMemory::FLAG); // batched to-be-shifted polynomials
+        batch_polynomials(g_batched, g_polynomials, g_scalars);
 
-        size_t num_groups = concatenation_groups.size();
+        // construct concatention_groups_batched: chunk j of every group, batched with the scalar of its group
         size_t num_chunks_per_group = concatenation_groups.empty() ? 0 : concatenation_groups[0].size();
-        // Concatenated polynomials
-        Polynomial concatenated_batched(N);
-
-        // construct concatention_groups_batched
         std::vector<Polynomial> concatenation_groups_batched;
-        for (size_t i = 0; i < num_chunks_per_group; ++i) {
-            concatenation_groups_batched.push_back(Polynomial(N));
-        }
-        // for each group
-        for (size_t i = 0; i < num_groups; ++i) {
-            concatenated_batched.add_scaled(concatenated_polynomials[i], batching_scalar);
-            // for each element in a group
-            for (size_t j = 0; j < num_chunks_per_group; ++j) {
-                concatenation_groups_batched[j].add_scaled(concatenation_groups[i][j], batching_scalar);
+        concatenation_groups_batched.reserve(num_chunks_per_group);
+        for (size_t j = 0; j < num_chunks_per_group; ++j) {
+            RefVector<Polynomial> chunks;
+            for (size_t i = 0; i < num_groups; ++i) {
+                chunks.get_storage().push_back(&concatenation_groups[i][j]);
             }
-            batched_evaluation += batching_scalar * concatenated_evaluations[i];
-            batching_scalar *= rho;
+            concatenation_groups_batched.emplace_back(N, barretenberg::DontZeroMemory::FLAG);
+            batch_polynomials(concatenation_groups_batched.back(), chunks, concatenation_scalars);
         }
 
-        // Compute the full batched polynomial f = f_batched + g_batched.shifted() = f_batched + h_batched. This is the
-        // polynomial for which we compute the quotients q_k and prove f(u) = v_batched.
-        Polynomial f_polynomial = f_batched;
-        f_polynomial += g_batched.shifted();
-        f_polynomial += concatenated_batched;
+        // Compute the full batched polynomial f = f_batched + g_batched.shifted() = f_batched + h_batched, plus the
+        // batched concatenated polynomials. This is the polynomial for which we compute the quotients q_k and prove
+        // f(u) = v_batched.
+        Polynomial f_polynomial(N, barretenberg::DontZeroMemory::FLAG);
+        RefVector<Polynomial> f_polynomial_terms(f_batched);
+        std::vector<FF> f_polynomial_scalars{ FF(1) };
+        for (size_t i = 0; i < num_groups; ++i) {
+            f_polynomial_terms.get_storage().push_back(&concatenated_polynomials[i]);
+            f_polynomial_scalars.emplace_back(concatenation_scalars[i]);
+        }
+        batch_polynomials(f_polynomial, f_polynomial_terms, f_polynomial_scalars);
+        parallel_for_ranges(N - 1, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                f_polynomial[i] += g_batched[i + 1];
+            }
+        });
 
         // Compute the multilinear quotients q_k = q_k(X_0, ..., X_{k-1})
-        auto quotients = compute_multilinear_quotients(f_polynomial, u_challenge);
+        auto quotients = compute_multilinear_quotients(std::move(f_polynomial), u_challenge);
 
-        // Compute and send commitments C_{q_k} = [q_k], k = 0,...,d-1
-        std::vector<Commitment> q_k_commitments;
-        q_k_commitments.reserve(log_N);
+        // Compute and send commitments C_{q_k} = [q_k], k = 0,...,d-1, in one batch
+        std::vector<std::span<const FF>> quotient_spans(quotients.begin(), quotients.end());
+        auto q_k_commitments = commitment_key->commit_batch(quotient_spans);
         for (size_t idx = 0; idx < log_N; ++idx) {
-            q_k_commitments[idx] = commitment_key->commit(quotients[idx]);
             std::string label = "ZM:C_q_" + std::to_string(idx);
             transcript->send_to_verifier(label, q_k_commitments[idx]);
         }
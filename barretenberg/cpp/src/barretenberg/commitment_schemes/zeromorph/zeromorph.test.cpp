@@ -35,9 +35,8 @@ template <class Curve> class ZeroMorphTest : public CommitmentTest<Curve> {
      * commitments [g_i] are contained in the set of commitments [f_i]).
      *
      */
-    bool execute_zeromorph_protocol(size_t NUM_UNSHIFTED, size_t NUM_SHIFTED)
+    bool execute_zeromorph_protocol(size_t NUM_UNSHIFTED, size_t NUM_SHIFTED, size_t N = 16)
     {
-        size_t N = 16;
         size_t log_N = numeric::get_msb(N);
 
         std::vector<Fr> u_challenge = this->random_evaluation_point(log_N);
@@ -78,8 +77,8 @@ template <class Curve> class ZeroMorphTest : public CommitmentTest<Curve> {
         auto prover_transcript = BaseTranscript::prover_init_empty();
 
         // Execute Prover protocol
-        ZeroMorphProver::prove(f_polynomials,
-                               g_polynomials,
+        ZeroMorphProver::prove(RefVector(f_polynomials),
+                               RefVector(g_polynomials),
                                v_evaluations,
                                w_evaluations,
                                u_challenge,
@@ -224,14 +223,14 @@ template <class Curve> class ZeroMorphWithConcatenationTest : public CommitmentT
         auto prover_transcript = BaseTranscript::prover_init_empty();
 
         // Execute Prover protocol
-        ZeroMorphProver::prove(f_polynomials, // unshifted
-                               g_polynomials, // to-be-shifted
+        ZeroMorphProver::prove(RefVector(f_polynomials), // unshifted
+                               RefVector(g_polynomials), // to-be-shifted
                                v_evaluations, // unshifted
                                w_evaluations, // shifted
                                u_challenge,
                                this->commitment_key,
                                prover_transcript,
-                               concatenated_polynomials,
+                               RefVector(concatenated_polynomials),
                                c_evaluations,
                                to_vector_of_ref_vectors(concatenation_groups));
 
@@ -520,6 +519,18 @@ TYPED_TEST(ZeroMorphTest, ProveAndVerifyBatchedWithShifts)
     EXPECT_TRUE(verified);
 }
 
+/**
+ * @brief Test full Prover/Verifier protocol for polynomials large enough for the prover to split its work across threads
+ *
+ */
+TYPED_TEST(ZeroMorphTest, ProveAndVerifyLarge)
+{
+    size_t num_unshifted = 5;
+    size_t num_shifted = 3;
+    auto verified = this->execute_zeromorph_protocol(num_unshifted, num_shifted, 4096);
+    EXPECT_TRUE(verified);
+}
+
 /**
  * @brief Test full Prover/Verifier protocol for proving single multilinear evaluation
  *
@@ -0,0 +1,192 @@
+#include "execution_context.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/env/hardware_concurrency.hpp"
+#include "work_stealing_pool.hpp"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+thread_local ExecutionContext* current_context = nullptr;
+
+#ifdef __linux__
+void set_thread_affinity(const std::vector<size_t>& cpus)
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (size_t cpu : cpus) {
+        if (cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &set);
+        }
+    }
+    // Failing to pin (e.g. for a CPU outside of our cgroup) only costs performance, so it is not an error
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+std::vector<size_t> get_thread_affinity()
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    std::vector<size_t> cpus;
+    if (pthread_getaffinity_np(pthread_self(), sizeof(set), &set) == 0) {
+        for (size_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+    return cpus;
+}
+
+/**
+ * Reads the CPUs of a NUMA node from sysfs. The list has the form "0-3,8-11".
+ */
+std::vector<size_t> get_numa_node_cpus(int numa_node)
+{
+    std::ifstream file("/sys/devices/system/node/node" + std::to_string(numa_node) + "/cpulist");
+    if (!file) {
+        throw_or_abort("NUMA node " + std::to_string(numa_node) + " not found.");
+    }
+    std::vector<size_t> cpus;
+    std::string range;
+    while (std::getline(file, range, ',')) {
+        size_t first = 0;
+        size_t last = 0;
+        char dash = 0;
+        std::istringstream range_stream(range);
+        range_stream >> first;
+        last = (range_stream >> dash >> last) ? last : first;
+        for (size_t cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+#else
+void set_thread_affinity(const std::vector<size_t>& /*unused*/) {}
+
+std::vector<size_t> get_thread_affinity()
+{
+    return {};
+}
+#endif
+} // namespace
+
+ExecutionContext::ExecutionContext(size_t num_threads, std::vector<size_t> cpus, int numa_node)
+    : num_threads_(num_threads)
+    , cpus_(std::move(cpus))
+    , numa_node_(numa_node)
+{
+#ifdef __linux__
+    if (numa_node_ >= 0) {
+        const std::vector<size_t> node_cpus = get_numa_node_cpus(numa_node_);
+        if (cpus_.empty()) {
+            cpus_ = node_cpus;
+        } else {
+            std::erase_if(cpus_, [&](size_t cpu) {
+                return std::find(node_cpus.begin(), node_cpus.end(), cpu) == node_cpus.end();
+            });
+            if (cpus_.empty()) {
+                throw_or_abort("None of the CPUs of the execution context are on NUMA node " +
+                               std::to_string(numa_node_) + ".");
+            }
+        }
+    }
+#endif
+    if (num_threads_ == 0) {
+        num_threads_ = cpus_.empty() ? env_hardware_concurrency() : cpus_.size();
+    }
+#ifdef NO_MULTITHREADING
+    num_threads_ = 1;
+#else
+    // The thread entering the context takes the first CPU, so the workers start from the second
+    pool_ = std::make_unique<WorkStealingPool>(num_threads_ - 1, [this](size_t worker_index) {
+        current_context = this;
+        if (!cpus_.empty()) {
+            set_thread_affinity({ cpus_[(worker_index + 1) % cpus_.size()] });
+        }
+    });
+#endif
+}
+
+ExecutionContext::~ExecutionContext() = default;
+
+ExecutionContext* ExecutionContext::current()
+{
+    return current_context;
+}
+
+std::vector<size_t> ExecutionContext::available_cpus()
+{
+    const size_t max_num_cpus = env_hardware_concurrency();
+    std::vector<size_t> cpus;
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (size_t cpu = 0; cpu < CPU_SETSIZE && cpus.size() < max_num_cpus; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+#endif
+    if (cpus.empty()) {
+        for (size_t cpu = 0; cpu < max_num_cpus; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+std::vector<std::shared_ptr<ExecutionContext>> ExecutionContext::partition_machine(size_t num_contexts)
+{
+    const std::vector<size_t> cpus = available_cpus();
+    if (num_contexts > cpus.size()) {
+        throw_or_abort("Cannot partition " + std::to_string(cpus.size()) + " CPUs into " +
+                       std::to_string(num_contexts) + " isolated execution contexts.");
+    }
+    std::vector<std::shared_ptr<ExecutionContext>> contexts;
+    if (num_contexts == 0) {
+        return contexts;
+    }
+    // Any CPUs left over by the division stay unused, so that all contexts are the same size
+    const size_t cpus_per_context = cpus.size() / num_contexts;
+    for (size_t i = 0; i < num_contexts; ++i) {
+        const auto first = cpus.begin() + static_cast<std::ptrdiff_t>(i * cpus_per_context);
+        contexts.emplace_back(std::make_shared<ExecutionContext>(
+            cpus_per_context, std::vector<size_t>(first, first + static_cast<std::ptrdiff_t>(cpus_per_context))));
+    }
+    return contexts;
+}
+
+ScopedExecutionContext::ScopedExecutionContext(ExecutionContext* context)
+    : context_(context)
+    , previous_context_(current_context)
+{
+    if (context_ == nullptr) {
+        return;
+    }
+    current_context = context_;
+    if (!context_->cpus().empty()) {
+        previous_cpus_ = get_thread_affinity();
+        set_thread_affinity({ context_->cpus()[0] });
+    }
+}
+
+ScopedExecutionContext::~ScopedExecutionContext()
+{
+    if (context_ == nullptr) {
+        return;
+    }
+    current_context = previous_context_;
+    if (!previous_cpus_.empty()) {
+        set_thread_affinity(previous_cpus_);
+    }
+}
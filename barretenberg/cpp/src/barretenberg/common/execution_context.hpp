@@ -0,0 +1,78 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+class WorkStealingPool;
+
+/**
+ * @brief The threads a computation may use: how many, which CPUs they run on, and which NUMA node those belong to.
+ * @details Outside of any context, get_num_cpus() and parallel_for assume the process owns the whole machine. When
+ * several provers share one process, give each its own context and enter it with a ScopedExecutionContext around its
+ * work. Within the context, get_num_cpus() (and so thread_utils::calculate_num_threads, the pippenger thread split
+ * etc.) reports the context's thread count, and parallel_for and TaskGroup run on the context's own pool, whose
+ * workers are pinned to the context's CPUs. Contexts share no workers, so concurrent provers neither oversubscribe the
+ * machine nor evict each other's caches. Work spawned from inside a context, including on its workers, stays in it.
+ *
+ * Pinning is only supported on Linux, elsewhere the CPUs and NUMA node are ignored.
+ */
+class ExecutionContext {
+  public:
+    /**
+     * @param num_threads the number of threads to use, including the thread that enters the context. Zero means one
+     * per CPU of the context (or of the machine, if it has no CPUs).
+     * @param cpus the CPUs to pin the threads to, round robin. Empty means no pinning, unless `numa_node` is given.
+     * @param numa_node restricts the CPUs to those of this NUMA node (all of them, if `cpus` is empty). -1 means any
+     * node. Memory follows the threads by the kernel's first-touch policy.
+     */
+    ExecutionContext(size_t num_threads, std::vector<size_t> cpus = {}, int numa_node = -1);
+    ExecutionContext(const ExecutionContext& other) = delete;
+    ExecutionContext(ExecutionContext&& other) = delete;
+    ~ExecutionContext();
+
+    ExecutionContext& operator=(const ExecutionContext& other) = delete;
+    ExecutionContext& operator=(ExecutionContext&& other) = delete;
+
+    size_t num_threads() const { return num_threads_; }
+    const std::vector<size_t>& cpus() const { return cpus_; }
+    int numa_node() const { return numa_node_; }
+    WorkStealingPool* pool() const { return pool_.get(); }
+
+    // The context of the calling thread, or nullptr if it runs outside of any context
+    static ExecutionContext* current();
+
+    // The CPUs the calling thread may run on, at most env_hardware_concurrency() of them. On Linux this is its affinity
+    // mask, which also reflects cgroup cpusets, elsewhere the CPUs are just numbered. Call it outside of any
+    // ScopedExecutionContext, which pins the thread to a single CPU.
+    static std::vector<size_t> available_cpus();
+
+    // Splits the available CPUs into `num_contexts` disjoint, equally sized contexts. Fails if there are fewer CPUs than
+    // contexts, since the contexts could then not be isolated from each other.
+    static std::vector<std::shared_ptr<ExecutionContext>> partition_machine(size_t num_contexts);
+
+  private:
+    size_t num_threads_;
+    std::vector<size_t> cpus_;
+    int numa_node_;
+    std::unique_ptr<WorkStealingPool> pool_;
+};
+
+/**
+ * @brief Runs the calling thread in `context` for the lifetime of this object, pinned to the context's first CPU.
+ * @details The previous context and CPU affinity are restored on destruction. A null context leaves everything as is.
+ */
+class ScopedExecutionContext {
+  public:
+    explicit ScopedExecutionContext(ExecutionContext* context);
+    ScopedExecutionContext(const ScopedExecutionContext& other) = delete;
+    ScopedExecutionContext(ScopedExecutionContext&& other) = delete;
+    ~ScopedExecutionContext();
+
+    ScopedExecutionContext& operator=(const ScopedExecutionContext& other) = delete;
+    ScopedExecutionContext& operator=(ScopedExecutionContext&& other) = delete;
+
+  private:
+    ExecutionContext* context_;
+    ExecutionContext* previous_context_;
+    std::vector<size_t> previous_cpus_;
+};
@@ -1,10 +1,11 @@
+#include "thread.hpp"
 #include <cstddef>
 #include <functional>
 
 void parallel_for_omp(size_t num_iterations, const std::function<void(size_t)>& func)
 {
 #ifndef NO_OMP_MULTITHREADING
-#pragma omp parallel for
+#pragma omp parallel for num_threads(get_num_cpus())
 #endif
     for (size_t i = 0; i < num_iterations; ++i) {
         func(i);
@@ -0,0 +1,277 @@
+#include "execution_context.hpp"
+#include "thread.hpp"
+#include "work_stealing_pool.hpp"
+#include <algorithm>
+#include <chrono>
+
+#ifndef NO_MULTITHREADING
+namespace {
+// The pool the current thread is a worker of (if any), and its deque index within that pool. Threads outside of a
+// pool use its injection deque.
+thread_local const WorkStealingPool* worker_pool = nullptr;
+thread_local size_t worker_index = 0;
+} // namespace
+
+WorkStealingPool::WorkStealingPool(size_t num_threads, const std::function<void(size_t)>& on_worker_start)
+{
+    queues.reserve(num_threads + 1);
+    for (size_t i = 0; i < num_threads + 1; ++i) {
+        queues.emplace_back(std::make_unique<TaskQueue>());
+    }
+    workers.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+        workers.emplace_back(&WorkStealingPool::worker_loop, this, i, on_worker_start);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        stop = true;
+    }
+    sleep_condition.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+size_t WorkStealingPool::queue_index() const
+{
+    return worker_pool == this ? worker_index : injection_queue_index();
+}
+
+void WorkStealingPool::push(std::function<void()>&& task)
+{
+    {
+        TaskQueue& queue = *queues[queue_index()];
+        std::unique_lock<std::mutex> lock(queue.mutex);
+        queue.tasks.emplace_back(std::move(task));
+    }
+    // A worker going to sleep registers itself before re-checking `num_queued_`, so either we see it sleeping here or
+    // it sees our task (both counters are sequentially consistent)
+    num_queued_++;
+    if (num_sleeping_ > 0) {
+        { std::unique_lock<std::mutex> lock(sleep_mutex); }
+        sleep_condition.notify_one();
+    }
+}
+
+bool WorkStealingPool::try_pop_back(size_t index, std::function<void()>& task)
+{
+    TaskQueue& queue = *queues[index];
+    std::unique_lock<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) {
+        return false;
+    }
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    num_queued_--;
+    return true;
+}
+
+bool WorkStealingPool::try_pop_front(size_t index, std::function<void()>& task)
+{
+    TaskQueue& queue = *queues[index];
+    std::unique_lock<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) {
+        return false;
+    }
+    task = std::move(queue.tasks.front());
+    queue.tasks.pop_front();
+    num_queued_--;
+    return true;
+}
+
+/**
+ * Runs one queued task, if there is any. Prefers the calling thread's own deque, then the injection deque, then steals
+ * from the other workers (starting with the next worker along, to spread the thieves out).
+ */
+bool WorkStealingPool::try_run_task()
+{
+    if (num_queued_ == 0) {
+        return false;
+    }
+    std::function<void()> task;
+    const size_t own_index = queue_index();
+    bool found = try_pop_back(own_index, task);
+    if (!found && own_index != injection_queue_index()) {
+        found = try_pop_front(injection_queue_index(), task);
+    }
+    const size_t num_workers = workers.size();
+    for (size_t i = 1; !found && i <= num_workers; ++i) {
+        const size_t victim = (own_index + i) % (num_workers + 1);
+        if (victim != own_index && victim != injection_queue_index()) {
+            found = try_pop_front(victim, task);
+        }
+    }
+    if (!found) {
+        return false;
+    }
+    task();
+    return true;
+}
+
+void WorkStealingPool::worker_loop(size_t thread_index, const std::function<void(size_t)>& on_worker_start)
+{
+    worker_pool = this;
+    worker_index = thread_index;
+    if (on_worker_start) {
+        on_worker_start(thread_index);
+    }
+    while (true) {
+        if (try_run_task()) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        num_sleeping_++;
+        sleep_condition.wait(lock, [this] { return num_queued_ > 0 || stop; });
+        num_sleeping_--;
+        if (stop) {
+            break;
+        }
+    }
+}
+
+WorkStealingPool& get_current_pool()
+{
+    ExecutionContext* context = ExecutionContext::current();
+    if (context != nullptr) {
+        return *context->pool();
+    }
+    static WorkStealingPool pool(get_num_cpus() - 1);
+    return pool;
+}
+
+namespace {
+
+/**
+ * Runs `func` over [begin, end). Ranges larger than `grain_size` are split in half and the upper half is pushed as a
+ * task that idle threads can steal, so the work is divided up lazily according to where threads are free.
+ */
+void run_range(
+    TaskGroup& group, size_t begin, size_t end, const size_t grain_size, const std::function<void(size_t)>& func)
+{
+    while (end - begin > grain_size) {
+        const size_t mid = begin + (end - begin) / 2;
+        group.run([&group, mid, end, grain_size, &func]() { run_range(group, mid, end, grain_size, func); });
+        end = mid;
+    }
+    for (size_t i = begin; i < end; ++i) {
+        func(i);
+    }
+}
+} // namespace
+#else
+// Without threads a pool has no workers, and tasks run on the thread that pushes them. This keeps the pool (and so
+// ExecutionContext, which owns one) linkable in single threaded builds.
+WorkStealingPool::WorkStealingPool(size_t /*unused*/, const std::function<void(size_t)>& /*unused*/) {}
+
+WorkStealingPool::~WorkStealingPool() = default;
+
+void WorkStealingPool::push(std::function<void()>&& task)
+{
+    task();
+}
+
+bool WorkStealingPool::try_run_task()
+{
+    return false;
+}
+#endif
+
+TaskGroup::TaskGroup()
+#ifndef NO_MULTITHREADING
+    : pool_(&get_current_pool())
+#endif
+{}
+
+TaskGroup::~TaskGroup()
+{
+    // Tasks refer to the group, so it must outlive them. Any exception is dropped, as we can't throw from here.
+    wait_for_tasks();
+}
+
+void TaskGroup::run(std::function<void()> task)
+{
+#ifdef NO_MULTITHREADING
+    execute(task);
+#else
+    num_pending_++;
+    pool_->push([this, task = std::move(task)]() { execute(task); });
+#endif
+}
+
+void TaskGroup::execute(const std::function<void()>& task)
+{
+#ifndef __wasm__
+    try {
+        task();
+    } catch (...) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!exception_) {
+            exception_ = std::current_exception();
+        }
+    }
+#else
+    task();
+#endif
+#ifndef NO_MULTITHREADING
+    // Decrement under the lock: waiters take the lock before returning, so the group can't be destroyed while the last
+    // task is still notifying it
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (--num_pending_ == 0) {
+        complete_condition_.notify_all();
+    }
+#endif
+}
+
+void TaskGroup::wait_for_tasks()
+{
+#ifndef NO_MULTITHREADING
+    while (num_pending_ > 0) {
+        if (!pool_->try_run_task()) {
+            // Nothing to help with right now. Sleep until the group completes, but wake up now and then in case our
+            // remaining tasks have spawned work we could steal.
+            std::unique_lock<std::mutex> lock(mutex_);
+            complete_condition_.wait_for(lock, std::chrono::microseconds(100), [this] { return num_pending_ == 0; });
+        }
+    }
+    // The last task notifies us while holding the lock, wait for it to let go
+    std::unique_lock<std::mutex> lock(mutex_);
+#endif
+}
+
+void TaskGroup::wait()
+{
+    wait_for_tasks();
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (exception_) {
+        std::exception_ptr exception = exception_;
+        exception_ = nullptr;
+        std::rethrow_exception(exception);
+    }
+}
+
+/**
+ * A work-stealing strategy. The iteration range is recursively halved into tasks on per-thread deques, and idle
+ * threads steal the largest outstanding halves. Unlike the other strategies, the calling thread may itself be running
+ * a task of the pool, so parallel_for calls can be nested (and can run concurrently from several threads).
+ */
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+#ifdef NO_MULTITHREADING
+    for (size_t i = 0; i < num_iterations; ++i) {
+        func(i);
+    }
+#else
+    if (num_iterations == 0) {
+        return;
+    }
+    // A few chunks per thread is enough to balance the load, without paying for a task per iteration
+    const size_t grain_size = std::max(num_iterations / (get_num_cpus() * 4), size_t(1));
+    TaskGroup group;
+    run_range(group, 0, num_iterations, grain_size, func);
+    group.wait();
+#endif
+}
@@ -3,8 +3,12 @@
 #include <barretenberg/common/log.hpp>
 #include <barretenberg/common/mem.hpp>
 #include <cstddef>
+#include <cstring>
 #include <numeric>
 #include <unordered_map>
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/mman.h>
+#endif
 
 #define LOGGING 0
 
@@ -216,6 +220,25 @@ std::shared_ptr<void> get_mem_slab(size_t size)
     return allocator.get(size);
 }
 
+std::shared_ptr<void> get_zeroed_mem_pages(size_t size)
+{
+#if defined(__linux__) || defined(__APPLE__)
+    // Smaller than this, a mapping's syscalls and page faults cost more than zeroing a slab
+    constexpr size_t MIN_MAPPING_SIZE = 1UL << 16;
+    if (size >= MIN_MAPPING_SIZE) {
+        void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED) {
+            info("bad alloc of size: ", size);
+            std::abort();
+        }
+        return { ptr, [size](void* p) { munmap(p, size); } };
+    }
+#endif
+    auto slab = get_mem_slab(size);
+    std::memset(slab.get(), 0, size);
+    return slab;
+}
+
 void* get_mem_slab_raw(size_t size)
 {
     auto slab = get_mem_slab(size);
@@ -33,6 +33,13 @@ void init_slab_allocator(size_t circuit_subgroup_size);
  */
 std::shared_ptr<void> get_mem_slab(size_t size);
 
+/**
+ * Returns zeroed memory of which only the pages that get written to take up physical memory, for large allocations that
+ * are mostly left zero. Natively it is an anonymous mapping, whose untouched pages read from the kernel's zero page. In
+ * WASM, and below a few pages, it is a zeroed slab.
+ */
+std::shared_ptr<void> get_zeroed_mem_pages(size_t size);
+
 /**
  * Sometimes you want a raw pointer to a slab so you can manage when it's released manually (e.g. c_binds, containers).
  * This still gets a slab with a shared_ptr, but holds the shared_ptr internally until free_mem_slab_raw is called.
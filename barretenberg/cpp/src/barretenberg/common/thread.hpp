@@ -1,18 +1,24 @@
 #pragma once
+#include "execution_context.hpp"
 #include <atomic>
 #include <barretenberg/env/hardware_concurrency.hpp>
 #include <barretenberg/numeric/bitop/get_msb.hpp>
+#include <condition_variable>
+#include <exception>
 #include <functional>
 #include <iostream>
+#include <mutex>
 #include <thread>
 #include <vector>
 
+// The number of threads available to the calling thread: those of its ExecutionContext, or the whole machine's.
 inline size_t get_num_cpus()
 {
 #ifdef NO_MULTITHREADING
     return 1;
 #else
-    return env_hardware_concurrency();
+    const ExecutionContext* context = ExecutionContext::current();
+    return context != nullptr ? context->num_threads() : env_hardware_concurrency();
 #endif
 }
 
@@ -23,3 +29,43 @@ inline size_t get_num_cpus_pow2()
 }
 
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func);
+
+class WorkStealingPool;
+
+/**
+ * A group of tasks run on the work-stealing thread pool (see parallel_for_work_stealing.cpp) of the ExecutionContext
+ * the group was created in.
+ * Tasks may themselves run task groups or call `parallel_for`. A thread waiting on a group executes queued tasks
+ * (its own first, then ones stolen from other threads) rather than blocking, so nested parallelism neither serialises
+ * nor oversubscribes. This lets independent stages of a computation overlap, e.g.
+ *
+ *   TaskGroup group;
+ *   group.run([&]() { commitment_a = key.commit(poly_a); });
+ *   group.run([&]() { commitment_b = key.commit(poly_b); });
+ *   group.wait();
+ *
+ * If a task throws, the first exception is rethrown by `wait` once all tasks of the group have finished.
+ */
+class TaskGroup {
+  public:
+    TaskGroup();
+    TaskGroup(const TaskGroup& other) = delete;
+    TaskGroup(TaskGroup&& other) = delete;
+    ~TaskGroup();
+
+    TaskGroup& operator=(const TaskGroup& other) = delete;
+    TaskGroup& operator=(TaskGroup&& other) = delete;
+
+    void run(std::function<void()> task);
+    void wait();
+
+  private:
+    WorkStealingPool* pool_ = nullptr;
+    std::atomic<size_t> num_pending_ = 0;
+    std::mutex mutex_;
+    std::condition_variable complete_condition_;
+    std::exception_ptr exception_;
+
+    void execute(const std::function<void()>& task);
+    void wait_for_tasks();
+};
@@ -0,0 +1,143 @@
+#include "thread.hpp"
+#include <algorithm>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST(Thread, ParallelForVisitsEveryIteration)
+{
+    for (size_t num_iterations : { 0UL, 1UL, 3UL, 64UL, 1000UL, 100003UL }) {
+        std::vector<size_t> visits(num_iterations, 0);
+        parallel_for(num_iterations, [&](size_t i) { visits[i]++; });
+        for (size_t i = 0; i < num_iterations; ++i) {
+            EXPECT_EQ(visits[i], 1U);
+        }
+    }
+}
+
+TEST(Thread, NestedParallelFor)
+{
+    constexpr size_t outer = 16;
+    constexpr size_t inner = 1000;
+    std::vector<std::vector<size_t>> visits(outer, std::vector<size_t>(inner, 0));
+    parallel_for(outer, [&](size_t i) {
+        parallel_for(inner, [&](size_t j) {
+            parallel_for(2, [&](size_t k) {
+                if (k == 0) {
+                    visits[i][j]++;
+                }
+            });
+        });
+    });
+    for (size_t i = 0; i < outer; ++i) {
+        for (size_t j = 0; j < inner; ++j) {
+            EXPECT_EQ(visits[i][j], 1U);
+        }
+    }
+}
+
+TEST(Thread, ParallelForFromSeveralThreads)
+{
+    constexpr size_t num_callers = 4;
+    constexpr size_t num_iterations = 10000;
+    std::vector<std::atomic<size_t>> sums(num_callers);
+    std::vector<std::thread> callers;
+    for (size_t c = 0; c < num_callers; ++c) {
+        callers.emplace_back([&, c]() { parallel_for(num_iterations, [&](size_t i) { sums[c] += i; }); });
+    }
+    for (auto& caller : callers) {
+        caller.join();
+    }
+    for (auto& sum : sums) {
+        EXPECT_EQ(sum, num_iterations * (num_iterations - 1) / 2);
+    }
+}
+
+TEST(Thread, TaskGroupRunsTasksAndPropagatesExceptions)
+{
+    std::atomic<size_t> count = 0;
+    TaskGroup group;
+    for (size_t i = 0; i < 100; ++i) {
+        group.run([&]() {
+            TaskGroup inner;
+            inner.run([&]() { count++; });
+            inner.run([&]() { count++; });
+            inner.wait();
+        });
+    }
+    group.wait();
+    EXPECT_EQ(count, 200U);
+
+    group.run([]() { throw std::runtime_error("task failed"); });
+    group.run([&]() { count++; });
+    EXPECT_THROW(group.wait(), std::runtime_error);
+    EXPECT_EQ(count, 201U);
+
+    // the group is reusable once the exception has been reported
+    group.run([&]() { count++; });
+    EXPECT_NO_THROW(group.wait());
+    EXPECT_EQ(count, 202U);
+}
+
+TEST(Thread, ExecutionContextLimitsThreads)
+{
+    const size_t machine_threads = get_num_cpus();
+    ExecutionContext context(2);
+    {
+        ScopedExecutionContext scoped_context(&context);
+        EXPECT_EQ(get_num_cpus(), 2U);
+        std::vector<size_t> num_cpus(100, 0);
+        parallel_for(num_cpus.size(), [&](size_t i) { num_cpus[i] = get_num_cpus(); });
+        for (size_t n : num_cpus) {
+            EXPECT_EQ(n, 2U);
+        }
+    }
+    EXPECT_EQ(get_num_cpus(), machine_threads);
+}
+
+TEST(Thread, ConcurrentExecutionContexts)
+{
+    constexpr size_t num_iterations = 10000;
+    auto contexts = ExecutionContext::partition_machine(std::min<size_t>(4, ExecutionContext::available_cpus().size()));
+    std::vector<size_t> sums(contexts.size(), 0);
+    std::vector<std::thread> provers;
+    for (size_t c = 0; c < contexts.size(); ++c) {
+        provers.emplace_back([&, c]() {
+            ScopedExecutionContext scoped_context(contexts[c].get());
+            std::vector<size_t> values(num_iterations);
+            parallel_for(16, [&](size_t i) {
+                parallel_for(num_iterations / 16, [&](size_t j) {
+                    EXPECT_EQ(ExecutionContext::current(), contexts[c].get());
+                    values[i * (num_iterations / 16) + j] = i * (num_iterations / 16) + j;
+                });
+            });
+            for (size_t value : values) {
+                sums[c] += value;
+            }
+        });
+    }
+    for (auto& prover : provers) {
+        prover.join();
+    }
+    for (size_t sum : sums) {
+        EXPECT_EQ(sum, num_iterations * (num_iterations - 1) / 2);
+    }
+}
+
+TEST(Thread, PartitionMachine)
+{
+    const std::vector<size_t> available = ExecutionContext::available_cpus();
+    ASSERT_FALSE(available.empty());
+    auto contexts = ExecutionContext::partition_machine(available.size());
+    std::vector<size_t> used;
+    for (const auto& context : contexts) {
+        EXPECT_EQ(context->cpus().size(), 1U);
+        used.insert(used.end(), context->cpus().begin(), context->cpus().end());
+    }
+    // every context gets its own CPU, out of those the process may use
+    EXPECT_EQ(used, available);
+
+    EXPECT_THROW(ExecutionContext::partition_machine(available.size() + 1), std::runtime_error);
+}
@@ -3,7 +3,8 @@
 namespace barretenberg::thread_utils {
 /**
  * @brief calculates number of threads to create based on minimum iterations per thread
- * @details Finds the number of cpus with get_num_cpus(), and calculates `desired_num_threads`
+ * @details Finds the number of cpus with get_num_cpus() (those of the current ExecutionContext, if any), and
+ * calculates `desired_num_threads`
  * Returns the min of `desired_num_threads` and `max_num_threads`.
  * Note that it will not calculate a power of 2 necessarily, use `calculate_num_threads_pow2` instead
  *
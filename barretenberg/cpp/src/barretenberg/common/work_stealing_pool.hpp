@@ -0,0 +1,64 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * A pool of workers that each own a deque of tasks. A thread pushes and pops tasks at the back of its own deque (so
+ * it works depth first, on the most recently split, smallest piece of work), and steals from the front of other
+ * deques (taking the oldest, largest pieces of work). Threads outside of the pool (e.g. the main thread) push to a
+ * shared injection deque, and take part in the work whenever they wait on a TaskGroup.
+ *
+ * This is the engine behind TaskGroup and parallel_for (see parallel_for_work_stealing.cpp). There is one default pool
+ * for the whole machine, and one per ExecutionContext.
+ */
+class WorkStealingPool {
+  public:
+    /**
+     * @param num_threads the number of workers to start
+     * @param on_worker_start run by each worker, with its index, before it takes any tasks (e.g. to pin it to a CPU)
+     */
+    WorkStealingPool(size_t num_threads, const std::function<void(size_t)>& on_worker_start = {});
+    WorkStealingPool(const WorkStealingPool& other) = delete;
+    WorkStealingPool(WorkStealingPool&& other) = delete;
+    ~WorkStealingPool();
+
+    WorkStealingPool& operator=(const WorkStealingPool& other) = delete;
+    WorkStealingPool& operator=(WorkStealingPool&& other) = delete;
+
+    void push(std::function<void()>&& task);
+    bool try_run_task();
+
+  private:
+    struct alignas(64) TaskQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    // one deque per worker, followed by the injection deque of threads outside of the pool
+    std::vector<std::unique_ptr<TaskQueue>> queues;
+    std::vector<std::thread> workers;
+    std::atomic<size_t> num_queued_ = 0;
+    std::atomic<size_t> num_sleeping_ = 0;
+    std::mutex sleep_mutex;
+    std::condition_variable sleep_condition;
+    bool stop = false;
+
+    size_t injection_queue_index() const { return queues.size() - 1; }
+    size_t queue_index() const;
+    bool try_pop_back(size_t index, std::function<void()>& task);
+    bool try_pop_front(size_t index, std::function<void()>& task);
+    void worker_loop(size_t thread_index, const std::function<void(size_t)>& on_worker_start);
+};
+
+/**
+ * The pool that work started on the calling thread runs on: the pool of the current ExecutionContext, or the default
+ * pool if there is none.
+ */
+WorkStealingPool& get_current_pool();
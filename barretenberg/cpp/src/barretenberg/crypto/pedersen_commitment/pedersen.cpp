@@ -20,6 +20,17 @@ namespace crypto {
 template <typename Curve>
 typename Curve::AffineElement pedersen_commitment_base<Curve>::commit_native(const std::vector<Fq>& inputs,
                                                                              const GeneratorContext context)
+{
+    return commit_native(std::span<const Fq>(inputs), context);
+}
+
+/**
+ * @brief As above, but reads the inputs from a span and takes the context by reference, so callers with a fixed number
+ * of inputs (e.g. merkle tree pair hashes) can keep them on the stack instead of allocating a vector per commitment.
+ */
+template <typename Curve>
+typename Curve::AffineElement pedersen_commitment_base<Curve>::commit_native(std::span<const Fq> inputs,
+                                                                             const GeneratorContext& context)
 {
     const auto generators = context.generators->get(inputs.size(), context.offset, context.domain_separator);
     Element result = Group::point_at_infinity;
@@ -5,6 +5,7 @@
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include <array>
+#include <span>
 
 namespace crypto {
 
@@ -28,6 +29,7 @@ template <typename Curve> class pedersen_commitment_base {
     using GeneratorContext = typename crypto::GeneratorContext<Curve>;
 
     static AffineElement commit_native(const std::vector<Fq>& inputs, GeneratorContext context = {});
+    static AffineElement commit_native(std::span<const Fq> inputs, const GeneratorContext& context = {});
 };
 
 extern template class pedersen_commitment_base<curve::Grumpkin>;
@@ -57,6 +57,16 @@ std::vector<typename Curve::BaseField> pedersen_hash_base<Curve>::convert_buffer
  */
 template <typename Curve>
 typename Curve::BaseField pedersen_hash_base<Curve>::hash(const std::vector<Fq>& inputs, const GeneratorContext context)
+{
+    return hash(std::span<const Fq>(inputs), context);
+}
+
+/**
+ * @brief As above, but reads the inputs from a span and takes the context by reference, so hashing a fixed number of
+ * inputs with a long-lived context needs no heap allocation.
+ */
+template <typename Curve>
+typename Curve::BaseField pedersen_hash_base<Curve>::hash(std::span<const Fq> inputs, const GeneratorContext& context)
 {
     Element result = length_generator * Fr(inputs.size());
     return (result + pedersen_commitment_base<Curve>::commit_native(inputs, context)).normalize().x;
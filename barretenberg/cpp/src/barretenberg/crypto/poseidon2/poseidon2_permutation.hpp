@@ -4,9 +4,11 @@
 
 #include "barretenberg/common/throw_or_abort.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <span>
 #include <vector>
 
 namespace crypto {
@@ -152,5 +154,107 @@ template <typename Params> class Poseidon2Permutation {
         }
         return current_state;
     }
+
+    // Number of states that permutation_batch permutes side by side
+    static constexpr size_t BATCH_LANES = 8;
+    // A batch of states as a struct of arrays: soa[i][l] is element i of the state in lane l
+    using BatchState = std::array<std::array<FF, BATCH_LANES>, t>;
+
+    /**
+     * @brief Applies the permutation to each of `states`, in place.
+     * @details The states are permuted BATCH_LANES at a time. Each batch is transposed into a struct of arrays (one
+     * array of lanes per state element), and every step of a round loops over the lanes. The lanes are independent, so
+     * the CPU can overlap their field multiplications instead of waiting on each in turn, which matters most in the
+     * partial rounds where a single state is one long chain of dependent multiplications. The batch stays in this
+     * layout for all rounds and is transposed back once at the end.
+     */
+    static void permutation_batch(std::span<State> states)
+    {
+        BatchState soa;
+        for (size_t batch = 0; batch < states.size(); batch += BATCH_LANES) {
+            // A short last batch is padded with zero states, whose results are dropped
+            const size_t num_lanes = std::min(BATCH_LANES, states.size() - batch);
+            for (size_t l = 0; l < BATCH_LANES; ++l) {
+                for (size_t i = 0; i < t; ++i) {
+                    soa[i][l] = l < num_lanes ? states[batch + l][i] : FF::zero();
+                }
+            }
+            permute_lanes(soa);
+            for (size_t l = 0; l < num_lanes; ++l) {
+                for (size_t i = 0; i < t; ++i) {
+                    states[batch + l][i] = soa[i][l];
+                }
+            }
+        }
+    }
+
+  private:
+    // matrix_multiplication_4x4 on every lane, reading and writing the struct of arrays in place
+    static void matrix_multiplication_external_lanes(BatchState& soa)
+    {
+        static_assert(t == 4, "only t = 4 is supported");
+        for (size_t l = 0; l < BATCH_LANES; ++l) {
+            auto t0 = soa[0][l] + soa[1][l]; // A + B
+            auto t1 = soa[2][l] + soa[3][l]; // C + D
+            auto t2 = soa[1][l] + soa[1][l]; // 2B
+            t2 += t1;                        // 2B + C + D
+            auto t3 = soa[3][l] + soa[3][l]; // 2D
+            t3 += t0;                        // 2D + A + B
+            auto t4 = t1 + t1;
+            t4 += t4;
+            t4 += t3; // A + B + 4C + 6D
+            auto t5 = t0 + t0;
+            t5 += t5;
+            t5 += t2;            // 4A + 6B + C + D
+            soa[0][l] = t3 + t5; // 5A + 7B + C + 3D
+            soa[1][l] = t5;
+            soa[2][l] = t2 + t4; // A + 3B + 5C + 7D
+            soa[3][l] = t4;
+        }
+    }
+
+    static void full_round_lanes(BatchState& soa, const RoundConstants& rc)
+    {
+        for (size_t i = 0; i < t; ++i) {
+            for (size_t l = 0; l < BATCH_LANES; ++l) {
+                soa[i][l] += rc[i];
+                apply_single_sbox(soa[i][l]);
+            }
+        }
+        matrix_multiplication_external_lanes(soa);
+    }
+
+    static void permute_lanes(BatchState& soa)
+    {
+        matrix_multiplication_external_lanes(soa);
+
+        constexpr size_t rounds_f_beginning = rounds_f / 2;
+        for (size_t i = 0; i < rounds_f_beginning; ++i) {
+            full_round_lanes(soa, round_constants[i]);
+        }
+
+        const size_t p_end = rounds_f_beginning + rounds_p;
+        for (size_t i = rounds_f_beginning; i < p_end; ++i) {
+            for (size_t l = 0; l < BATCH_LANES; ++l) {
+                soa[0][l] += round_constants[i][0];
+                apply_single_sbox(soa[0][l]);
+            }
+            // matrix_multiplication_internal, a lane at a time
+            for (size_t l = 0; l < BATCH_LANES; ++l) {
+                FF sum = soa[0][l];
+                for (size_t j = 1; j < t; ++j) {
+                    sum += soa[j][l];
+                }
+                for (size_t j = 0; j < t; ++j) {
+                    soa[j][l] *= internal_matrix_diagonal[j];
+                    soa[j][l] += sum;
+                }
+            }
+        }
+
+        for (size_t i = p_end; i < NUM_ROUNDS; ++i) {
+            full_round_lanes(soa, round_constants[i]);
+        }
+    }
 };
 } // namespace crypto
\ No newline at end of file
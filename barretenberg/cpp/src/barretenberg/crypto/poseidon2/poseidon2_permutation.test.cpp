@@ -62,4 +62,22 @@ TEST(Poseidon2Permutation, ConsistencyCheck)
     EXPECT_EQ(result, expected);
 }
 
+TEST(Poseidon2Permutation, BatchMatchesSingle)
+{
+    using Permutation = crypto::Poseidon2Permutation<crypto::Poseidon2Bn254ScalarFieldParams>;
+    // Two full batches and a partial one
+    std::vector<Permutation::State> states(Permutation::BATCH_LANES * 2 + 3);
+    for (auto& state : states) {
+        for (auto& element : state) {
+            element = barretenberg::fr::random_element(&engine);
+        }
+    }
+    std::vector<Permutation::State> expected;
+    for (auto const& state : states) {
+        expected.push_back(Permutation::permutation(state));
+    }
+    Permutation::permutation_batch(states);
+    EXPECT_EQ(states, expected);
+}
+
 } // namespace poseidon2_tests
\ No newline at end of file
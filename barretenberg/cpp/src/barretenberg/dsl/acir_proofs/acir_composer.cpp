@@ -38,6 +38,7 @@ template <typename Builder> void AcirComposer::create_circuit(acir_format::acir_
 std::shared_ptr<proof_system::plonk::proving_key> AcirComposer::init_proving_key(
     acir_format::acir_format& constraint_system)
 {
+    ScopedExecutionContext scoped_context(execution_context_.get());
     create_circuit(constraint_system);
     acir_format::Composer composer;
     vinfo("computing proving key...");
@@ -49,6 +50,7 @@ std::vector<uint8_t> AcirComposer::create_proof(acir_format::acir_format& constr
                                                 acir_format::WitnessVector& witness,
                                                 bool is_recursive)
 {
+    ScopedExecutionContext scoped_context(execution_context_.get());
     vinfo("building circuit with witness...");
     builder_ = acir_format::Builder(size_hint_);
     create_circuit_with_witness(builder_, constraint_system, witness);
@@ -82,6 +84,7 @@ std::vector<uint8_t> AcirComposer::create_proof(acir_format::acir_format& constr
 void AcirComposer::create_goblin_circuit(acir_format::acir_format& constraint_system,
                                          acir_format::WitnessVector& witness)
 {
+    ScopedExecutionContext scoped_context(execution_context_.get());
     // The public inputs in constraint_system do not index into "witness" but rather into the future "variables" which
     // it assumes will be equal to witness but with a prepended zero. We want to remove this +1 so that public_inputs
     // properly indexes into witness because we're about to make calls like add_variable(witness[public_inputs[idx]]).
@@ -107,11 +110,13 @@ void AcirComposer::create_goblin_circuit(acir_format::acir_format& constraint_sy
 
 std::vector<uint8_t> AcirComposer::create_goblin_proof()
 {
+    ScopedExecutionContext scoped_context(execution_context_.get());
     return goblin.construct_proof(goblin_builder_);
 }
 
 std::shared_ptr<proof_system::plonk::verification_key> AcirComposer::init_verification_key()
 {
+    ScopedExecutionContext scoped_context(execution_context_.get());
     if (!proving_key_) {
         throw_or_abort("Compute proving key first.");
     }
@@ -130,6 +135,7 @@ void AcirComposer::load_verification_key(proof_system::plonk::verification_key_d
 
 bool AcirComposer::verify_proof(std::vector<uint8_t> const& proof, bool is_recursive)
 {
+    ScopedExecutionContext scoped_context(execution_context_.get());
     acir_format::Composer composer(proving_key_, verification_key_);
 
     if (!verification_key_) {
@@ -162,6 +168,7 @@ bool AcirComposer::verify_proof(std::vector<uint8_t> const& proof, bool is_recur
 
 bool AcirComposer::verify_goblin_proof(std::vector<uint8_t> const& proof)
 {
+    ScopedExecutionContext scoped_context(execution_context_.get());
     return goblin.verify_proof({ proof });
 }
 
@@ -1,4 +1,5 @@
 #pragma once
+#include <barretenberg/common/execution_context.hpp>
 #include <barretenberg/dsl/acir_format/acir_format.hpp>
 #include <barretenberg/goblin/goblin.hpp>
 #include <barretenberg/proof_system/op_queue/ecc_op_queue.hpp>
@@ -15,6 +16,12 @@ class AcirComposer {
   public:
     AcirComposer(size_t size_hint = 0, bool verbose = true);
 
+    /**
+     * @brief Runs the composer's key construction, proving and verification in `context` (e.g. one of
+     * ExecutionContext::partition_machine) rather than across the whole machine. A null context restores the default.
+     */
+    void set_execution_context(std::shared_ptr<ExecutionContext> context) { execution_context_ = std::move(context); }
+
     template <typename Builder = UltraCircuitBuilder> void create_circuit(acir_format::acir_format& constraint_system);
 
     std::shared_ptr<proof_system::plonk::proving_key> init_proving_key(acir_format::acir_format& constraint_system);
@@ -55,6 +62,7 @@ class AcirComposer {
     std::shared_ptr<proof_system::plonk::proving_key> proving_key_;
     std::shared_ptr<proof_system::plonk::verification_key> verification_key_;
     bool verbose_ = true;
+    std::shared_ptr<ExecutionContext> execution_context_;
 
     template <typename... Args> inline void vinfo(Args... args)
     {
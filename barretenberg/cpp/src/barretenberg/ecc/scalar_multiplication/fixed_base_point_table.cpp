@@ -0,0 +1,499 @@
+#include "./fixed_base_point_table.hpp"
+#include "./process_buckets.hpp"
+#include "./scalar_multiplication.hpp"
+
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/slab_allocator.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/thread_utils.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <vector>
+
+namespace barretenberg::scalar_multiplication {
+
+namespace {
+
+// the number of copies can never exceed the number of WNAF rounds, which is at most 64 (for 2-bit windows)
+constexpr size_t MAX_NUM_COPIES = 64;
+
+// the number of base points whose shifted copies are computed in one batch (one batch inversion per copy)
+constexpr size_t TABLE_BATCH_SIZE = 1024;
+
+struct fixed_base_parameters {
+    size_t num_copies = 0;
+    size_t bits_per_bucket = 0;
+    size_t num_rounds = 0;
+    size_t rounds_per_copy = 0;
+};
+
+// the widest bucket width that `get_optimal_bucket_width` selects
+constexpr size_t MAX_BITS_PER_BUCKET = 21;
+
+/**
+ * A rough cost model for a pippenger MSM, in units of affine point additions. Every WNAF entry costs one amortised
+ * affine addition, and every bucket costs two Jacobian additions in the running sum reduction, which we price at four
+ * affine additions.
+ **/
+constexpr size_t estimate_pippenger_cost(const size_t num_initial_points,
+                                         const size_t bits_per_bucket,
+                                         const size_t num_bucket_rounds)
+{
+    return WNAF_SIZE(bits_per_bucket + 1) * 2 * num_initial_points + 4 * num_bucket_rounds * (1ULL << bits_per_bucket);
+}
+
+constexpr size_t estimate_pippenger_cost(const size_t num_initial_points)
+{
+    const size_t bits_per_bucket = get_optimal_bucket_width(num_initial_points);
+    return estimate_pippenger_cost(num_initial_points, bits_per_bucket, WNAF_SIZE(bits_per_bucket + 1));
+}
+
+/**
+ * Pick the table shape for a given memory budget. Every copy stores an endomorphism-expanded point table.
+ * For every bucket width, we use as many copies as the budget allows to minimise the number of bucket rounds, and keep
+ * the cheapest configuration according to `estimate_pippenger_cost`. If no configuration beats regular pippenger, the
+ * returned parameters are empty.
+ **/
+template <typename AffineElement>
+fixed_base_parameters get_fixed_base_parameters(const size_t num_points, const size_t memory_budget)
+{
+    fixed_base_parameters params;
+    if (num_points == 0) {
+        return params;
+    }
+    const size_t copy_size = 2 * num_points * sizeof(AffineElement);
+    const size_t max_num_copies = std::min(memory_budget / copy_size, MAX_NUM_COPIES);
+    if (max_num_copies < 2) {
+        return params;
+    }
+    size_t best_cost = estimate_pippenger_cost(num_points);
+    for (size_t bits_per_bucket = 1; bits_per_bucket <= MAX_BITS_PER_BUCKET; ++bits_per_bucket) {
+        const size_t num_rounds = WNAF_SIZE(bits_per_bucket + 1);
+        const size_t rounds_per_copy = (num_rounds + max_num_copies - 1) / max_num_copies;
+        const size_t num_copies = (num_rounds + rounds_per_copy - 1) / rounds_per_copy;
+        const size_t cost = estimate_pippenger_cost(num_points, bits_per_bucket, rounds_per_copy);
+        if (num_copies >= 2 && cost < best_cost) {
+            best_cost = cost;
+            params = { num_copies, bits_per_bucket, num_rounds, rounds_per_copy };
+        }
+    }
+    return params;
+}
+
+/**
+ * A sorted slice of one WNAF round, whose entries refer to the copy of the point table located at `point_offset`.
+ * `end` shrinks as the bucket range is consumed from the top down.
+ **/
+struct round_block {
+    const uint64_t* schedule;
+    size_t begin;
+    size_t end;
+    uint64_t point_offset;
+};
+
+size_t get_bucket_position(const round_block& block, const size_t bucket)
+{
+    const uint64_t* it = std::lower_bound(
+        block.schedule + block.begin, block.schedule + block.end, bucket, [](const uint64_t entry, const size_t value) {
+            return static_cast<size_t>(entry & 0x7fffffffU) < value;
+        });
+    return static_cast<size_t>(it - block.schedule);
+}
+
+/**
+ * Evaluate ∑ (2b + 1)⋅B_b over the buckets b ∈ [bucket_lo, bucket_hi), where B_b is the sum of all points that the
+ * round blocks assign to bucket b.
+ *
+ * A merged round has `num_copies` times as many entries as a regular pippenger round, so we cannot materialise it in
+ * the regular pippenger scratch space in one go. Instead, we walk the bucket range from the top down in chunks that
+ * fit into the thread's slice of the runtime state. Each chunk only touches complete buckets, so the running sum
+ * bucket reduction can be carried across chunks.
+ **/
+template <typename Curve>
+typename Curve::Element evaluate_bucket_range(const affine_product_runtime_state<Curve>& thread_state,
+                                              typename Curve::AffineElement* points,
+                                              round_block* blocks,
+                                              const size_t num_blocks,
+                                              uint64_t* chunk_schedule,
+                                              const size_t chunk_capacity,
+                                              const size_t max_chunk_buckets,
+                                              const size_t bucket_lo,
+                                              const size_t bucket_hi,
+                                              const uint32_t wnaf_bits)
+{
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+    Element running_sum;
+    Element accumulator;
+    running_sum.self_set_infinity();
+    accumulator.self_set_infinity();
+
+    const auto count_entries_from = [&](const size_t bucket) {
+        size_t count = 0;
+        for (size_t k = 0; k < num_blocks; ++k) {
+            count += blocks[k].end - get_bucket_position(blocks[k], bucket);
+        }
+        return count;
+    };
+
+    const auto reduce_chunk = [&](const size_t num_entries, const size_t num_buckets) {
+        affine_product_runtime_state<Curve> product_state = thread_state;
+        product_state.num_points = static_cast<uint32_t>(num_entries);
+        product_state.points = points;
+        product_state.point_schedule = chunk_schedule;
+        product_state.num_buckets = static_cast<uint32_t>(num_buckets);
+        AffineElement* output_buckets = reduce_buckets(product_state, true, false);
+        return std::make_pair(product_state, output_buckets);
+    };
+
+    size_t chunk_hi = bucket_hi;
+    while (chunk_hi > bucket_lo) {
+        size_t chunk_lo = chunk_hi - std::min(max_chunk_buckets, chunk_hi - bucket_lo);
+        if (count_entries_from(chunk_lo) > chunk_capacity) {
+            // binary search for the widest chunk that fits. Invariant: `lo` does not fit, `hi` does
+            size_t lo = chunk_lo;
+            size_t hi = chunk_hi;
+            while (hi - lo > 1) {
+                const size_t mid = lo + (hi - lo) / 2;
+                if (count_entries_from(mid) > chunk_capacity) {
+                    lo = mid;
+                } else {
+                    hi = mid;
+                }
+            }
+            chunk_lo = hi;
+        }
+
+        if (chunk_lo == chunk_hi) {
+            // A single bucket has more entries than we can hold in scratch space (e.g. a constant polynomial).
+            // Reduce its entries piece by piece and sum the partial results
+            const size_t bucket = chunk_hi - 1;
+            Element bucket_sum;
+            bucket_sum.self_set_infinity();
+            size_t num_entries = 0;
+            const auto flush = [&]() {
+                if (num_entries > 0) {
+                    bucket_sum += reduce_chunk(num_entries, 1).second[0];
+                    num_entries = 0;
+                }
+            };
+            for (size_t k = 0; k < num_blocks; ++k) {
+                const size_t position = get_bucket_position(blocks[k], bucket);
+                for (size_t i = position; i < blocks[k].end; ++i) {
+                    chunk_schedule[num_entries++] = blocks[k].schedule[i] + blocks[k].point_offset;
+                    if (num_entries == chunk_capacity) {
+                        flush();
+                    }
+                }
+                blocks[k].end = position;
+            }
+            flush();
+            running_sum += bucket_sum;
+            if (bucket > bucket_lo) {
+                accumulator += running_sum;
+            }
+            chunk_hi = bucket;
+            continue;
+        }
+
+        size_t num_entries = 0;
+        for (size_t k = 0; k < num_blocks; ++k) {
+            const size_t position = get_bucket_position(blocks[k], chunk_lo);
+            for (size_t i = position; i < blocks[k].end; ++i) {
+                chunk_schedule[num_entries++] = blocks[k].schedule[i] + blocks[k].point_offset;
+            }
+            blocks[k].end = position;
+        }
+
+        if (num_entries == 0) {
+            if (chunk_lo > bucket_lo) {
+                // every bucket in this chunk is empty, so the running sum is added once per bucket
+                accumulator += small_scalar_mul(running_sum, chunk_hi - chunk_lo);
+            } else {
+                accumulator += small_scalar_mul(running_sum, chunk_hi - chunk_lo - 1);
+            }
+            chunk_hi = chunk_lo;
+            continue;
+        }
+
+        // entries from different copies interleave, so the chunk needs to be re-sorted by bucket
+        process_buckets(chunk_schedule, num_entries, wnaf_bits);
+        const size_t first_bucket = chunk_schedule[0] & 0x7fffffffU;
+        const size_t last_bucket = chunk_schedule[num_entries - 1] & 0x7fffffffU;
+        auto [product_state, output_buckets] = reduce_chunk(num_entries, (last_bucket - first_bucket) + 1);
+
+        size_t output_it = product_state.num_points - 1;
+        for (size_t bucket = chunk_hi; bucket-- > chunk_lo;) {
+            if (bucket >= first_bucket && bucket <= last_bucket &&
+                !product_state.bucket_empty_status[bucket - first_bucket]) {
+                running_sum += output_buckets[output_it];
+                --output_it;
+            }
+            if (bucket > bucket_lo) {
+                accumulator += running_sum;
+            }
+        }
+        chunk_hi = chunk_lo;
+    }
+
+    // accumulator = ∑ (b - bucket_lo)⋅B_b and running_sum = ∑ B_b, so
+    // ∑ (2b + 1)⋅B_b = 2⋅accumulator + running_sum + 2⋅bucket_lo⋅running_sum
+    accumulator.self_dbl();
+    accumulator += running_sum;
+    if (bucket_lo > 0) {
+        accumulator += small_scalar_mul(running_sum, static_cast<uint64_t>(bucket_lo) << 1ULL);
+    }
+    return accumulator;
+}
+
+template <typename Curve>
+typename Curve::Element pippenger_fixed_base_internal(typename Curve::ScalarField* scalars,
+                                                      const fixed_base_point_table<Curve>& point_table,
+                                                      const size_t point_offset,
+                                                      const size_t num_initial_points,
+                                                      pippenger_runtime_state<Curve>& state)
+{
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+    AffineElement* points = point_table.points.get();
+    const size_t num_points = num_initial_points * 2;
+    const size_t bits_per_bucket = point_table.bits_per_bucket;
+    const size_t num_rounds = point_table.num_rounds;
+    const size_t rounds_per_copy = point_table.rounds_per_copy;
+    // the state's scratch space is split between at most the threads it was created for (e.g. in a smaller
+    // ExecutionContext)
+    const size_t num_threads = std::min(get_num_cpus_pow2(), state.num_threads);
+    const size_t num_buckets = 1ULL << bits_per_bucket;
+
+    // The table is shaped for its full size. For small MSMs the wide buckets may not pay off, in which case we run the
+    // regular algorithm over the first copy. We also fall back if the runtime state cannot hold our WNAF schedule
+    const bool is_cheaper = estimate_pippenger_cost(num_initial_points, bits_per_bucket, rounds_per_copy) <
+                            estimate_pippenger_cost(num_initial_points);
+    const bool fits_in_state = num_rounds * num_points <= state.num_rounds * static_cast<size_t>(state.num_points);
+    if (!is_cheaper || !fits_in_state) {
+        return pippenger_internal<Curve>(points + 2 * point_offset, scalars, num_initial_points, state, false);
+    }
+
+    compute_wnaf_states<Curve>(
+        state.point_schedule, state.skew_table, state.round_counts, scalars, num_initial_points, bits_per_bucket);
+    organize_buckets(state.point_schedule, num_points, num_rounds, bits_per_bucket);
+
+    // each thread works on its own slice of the runtime state's scratch space and bucket arrays
+    const size_t chunk_capacity = static_cast<size_t>(state.num_points) / num_threads;
+    const size_t max_chunk_buckets = state.num_buckets;
+    const size_t chunk_schedule_size = chunk_capacity + 32;
+    std::shared_ptr<void> chunk_schedule_ptr = get_mem_slab(num_threads * chunk_schedule_size * sizeof(uint64_t));
+    auto* chunk_schedules = static_cast<uint64_t*>(chunk_schedule_ptr.get());
+    memset(static_cast<void*>(chunk_schedules), 0, num_threads * chunk_schedule_size * sizeof(uint64_t));
+
+    std::vector<Element> thread_accumulators(num_threads);
+    parallel_for(num_threads, [&](size_t j) {
+        const affine_product_runtime_state<Curve> thread_state = state.get_affine_product_runtime_state(num_threads, j);
+        uint64_t* chunk_schedule = chunk_schedules + j * chunk_schedule_size;
+        const size_t bucket_lo = (j * num_buckets) / num_threads;
+        const size_t bucket_hi = ((j + 1) * num_buckets) / num_threads;
+
+        Element& thread_accumulator = thread_accumulators[j];
+        thread_accumulator.self_set_infinity();
+
+        // virtual rounds are processed from the most significant to the least significant window
+        for (size_t v = rounds_per_copy; v-- > 0;) {
+            std::array<round_block, MAX_NUM_COPIES> blocks;
+            size_t num_blocks = 0;
+            for (size_t k = 0; k < point_table.num_copies; ++k) {
+                // window index, counted from the least significant window
+                const size_t window = k * rounds_per_copy + v;
+                if (window >= num_rounds) {
+                    continue;
+                }
+                // `compute_wnaf_states` stores the most significant window first
+                const size_t round = num_rounds - 1 - window;
+                round_block block{ &state.point_schedule[round * num_points],
+                                   0,
+                                   static_cast<size_t>(state.round_counts[round]),
+                                   static_cast<uint64_t>(k * point_table.copy_stride + 2 * point_offset) << 32ULL };
+                block.begin = get_bucket_position(block, bucket_lo);
+                block.end = get_bucket_position(block, bucket_hi);
+                blocks[num_blocks++] = block;
+            }
+
+            Element round_accumulator = evaluate_bucket_range<Curve>(thread_state,
+                                                                     points,
+                                                                     &blocks[0],
+                                                                     num_blocks,
+                                                                     chunk_schedule,
+                                                                     chunk_capacity,
+                                                                     max_chunk_buckets,
+                                                                     bucket_lo,
+                                                                     bucket_hi,
+                                                                     static_cast<uint32_t>(bits_per_bucket + 1));
+            if (v + 1 < rounds_per_copy) {
+                for (size_t k = 0; k < bits_per_bucket + 1; ++k) {
+                    thread_accumulator.self_dbl();
+                }
+            }
+            thread_accumulator += round_accumulator;
+        }
+
+        // apply the skew correction against the unshifted copy of the point table
+        const size_t num_points_per_thread = num_points / num_threads;
+        const bool* skew_table = &state.skew_table[j * num_points_per_thread];
+        const AffineElement* skew_points = &points[2 * point_offset + j * num_points_per_thread];
+        for (size_t k = 0; k < num_points_per_thread; ++k) {
+            if (skew_table[k]) {
+                thread_accumulator += -skew_points[k];
+            }
+        }
+    });
+
+    Element result;
+    result.self_set_infinity();
+    for (const auto& thread_accumulator : thread_accumulators) {
+        result += thread_accumulator;
+    }
+    return result;
+}
+
+template <typename Curve>
+typename Curve::Element pippenger_fixed_base_slices(typename Curve::ScalarField* scalars,
+                                                    const fixed_base_point_table<Curve>& point_table,
+                                                    const size_t point_offset,
+                                                    const size_t num_initial_points,
+                                                    pippenger_runtime_state<Curve>& state)
+{
+    // below this threshold `pippenger` falls back to Strauss, which doesn't benefit from the table
+    const size_t threshold = get_num_cpus_pow2() * 8;
+    if (num_initial_points <= threshold) {
+        return pippenger<Curve>(scalars, point_table.points.get() + 2 * point_offset, num_initial_points, state, false);
+    }
+
+    const auto slice_bits = static_cast<size_t>(numeric::get_msb(static_cast<uint64_t>(num_initial_points)));
+    const auto num_slice_points = static_cast<size_t>(1ULL << slice_bits);
+
+    typename Curve::Element result =
+        pippenger_fixed_base_internal<Curve>(scalars, point_table, point_offset, num_slice_points, state);
+    if (num_slice_points != num_initial_points) {
+        result += pippenger_fixed_base_slices<Curve>(scalars + num_slice_points,
+                                                     point_table,
+                                                     point_offset + num_slice_points,
+                                                     num_initial_points - num_slice_points,
+                                                     state);
+    }
+    return result;
+}
+} // namespace
+
+template <typename Curve>
+size_t fixed_base_point_table<Curve>::get_num_copies(const size_t num_base_points, const size_t memory_budget)
+{
+    return get_fixed_base_parameters<AffineElement>(num_base_points, memory_budget).num_copies;
+}
+
+/**
+ * Build the shifted copies of `point_table`, an endomorphism-expanded pippenger point table of `num_base_points`
+ * points. If `memory_budget` (in bytes) cannot fit at least two copies, the table is left empty.
+ **/
+template <typename Curve>
+fixed_base_point_table<Curve>::fixed_base_point_table(const AffineElement* point_table,
+                                                      const size_t num_base_points,
+                                                      const size_t memory_budget)
+{
+    using Element = typename Curve::Element;
+
+    const fixed_base_parameters params = get_fixed_base_parameters<AffineElement>(num_base_points, memory_budget);
+    if (params.num_copies == 0) {
+        return;
+    }
+    num_points = num_base_points;
+    num_copies = params.num_copies;
+    bits_per_bucket = params.bits_per_bucket;
+    num_rounds = params.num_rounds;
+    rounds_per_copy = params.rounds_per_copy;
+    copy_stride = 2 * num_points;
+
+    const size_t prefetch_overflow = get_num_cpus_pow2() * 16;
+    const size_t table_size = num_copies * copy_stride + prefetch_overflow;
+    points = std::static_pointer_cast<AffineElement[]>(get_mem_slab(table_size * sizeof(AffineElement)));
+    AffineElement* table = points.get();
+    memcpy(static_cast<void*>(table), static_cast<const void*>(point_table), copy_stride * sizeof(AffineElement));
+    memset(static_cast<void*>(table + num_copies * copy_stride), 0, prefetch_overflow * sizeof(AffineElement));
+
+    // copy k holds 2^{k * copy_shift} times the base points
+    const size_t copy_shift = rounds_per_copy * (bits_per_bucket + 1);
+    const size_t num_batches = (num_points + TABLE_BATCH_SIZE - 1) / TABLE_BATCH_SIZE;
+    const size_t num_threads = barretenberg::thread_utils::calculate_num_threads(num_batches, 1);
+    const size_t batches_per_thread = (num_batches + num_threads - 1) / num_threads;
+    parallel_for(num_threads, [&](size_t j) {
+        std::vector<Element> shifted_points(TABLE_BATCH_SIZE);
+        std::vector<AffineElement> normalized_points(TABLE_BATCH_SIZE);
+        const size_t batch_end = std::min(num_batches, (j + 1) * batches_per_thread);
+        for (size_t batch = j * batches_per_thread; batch < batch_end; ++batch) {
+            const size_t start = batch * TABLE_BATCH_SIZE;
+            const size_t batch_size = std::min(TABLE_BATCH_SIZE, num_points - start);
+            for (size_t i = 0; i < batch_size; ++i) {
+                shifted_points[i] = Element(point_table[2 * (start + i)]);
+            }
+            for (size_t k = 1; k < num_copies; ++k) {
+                for (size_t i = 0; i < batch_size; ++i) {
+                    for (size_t l = 0; l < copy_shift; ++l) {
+                        shifted_points[i].self_dbl();
+                    }
+                }
+                Element::batch_normalize(&shifted_points[0], batch_size);
+                for (size_t i = 0; i < batch_size; ++i) {
+                    normalized_points[i] = AffineElement(shifted_points[i].x, shifted_points[i].y);
+                }
+                generate_pippenger_point_table<Curve>(
+                    &normalized_points[0], &table[k * copy_stride + 2 * start], batch_size);
+            }
+        }
+    });
+}
+
+template <typename Curve> size_t fixed_base_point_table<Curve>::get_memory_usage() const
+{
+    return num_copies * copy_stride * sizeof(AffineElement);
+}
+
+/**
+ * Evaluate ∑ scalars[i]⋅P_i over the first `num_initial_points` base points of `point_table`.
+ * Like `pippenger_unsafe`, this assumes that the incomplete addition formula exceptions are not triggered.
+ * `state` must have been constructed for at least `num_initial_points` points.
+ **/
+template <typename Curve>
+typename Curve::Element pippenger_fixed_base(typename Curve::ScalarField* scalars,
+                                             const fixed_base_point_table<Curve>& point_table,
+                                             const size_t num_initial_points,
+                                             pippenger_runtime_state<Curve>& state)
+{
+    ASSERT(!point_table.empty());
+    ASSERT(num_initial_points <= point_table.num_points);
+    if (num_initial_points == 0) {
+        typename Curve::Element out;
+        out.self_set_infinity();
+        return out;
+    }
+    return pippenger_fixed_base_slices<Curve>(scalars, point_table, 0, num_initial_points, state);
+}
+
+template struct fixed_base_point_table<curve::BN254>;
+template struct fixed_base_point_table<curve::Grumpkin>;
+
+template curve::BN254::Element pippenger_fixed_base<curve::BN254>(
+    curve::BN254::ScalarField* scalars,
+    const fixed_base_point_table<curve::BN254>& point_table,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::BN254>& state);
+
+template curve::Grumpkin::Element pippenger_fixed_base<curve::Grumpkin>(
+    curve::Grumpkin::ScalarField* scalars,
+    const fixed_base_point_table<curve::Grumpkin>& point_table,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state);
+} // namespace barretenberg::scalar_multiplication
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "./runtime_states.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+
+#include <cstddef>
+#include <memory>
+
+namespace barretenberg::scalar_multiplication {
+
+/**
+ * A precomputed table for multi-scalar multiplications over a fixed set of base points (e.g. the SRS held by a
+ * commitment key).
+ *
+ * Pippenger evaluates a 254-bit MSM as a sequence of `num_rounds` windows, doubling the accumulator `bits_per_bucket
+ * + 1` times between consecutive windows. If we know the base points ahead of time, we can store `num_copies` shifted
+ * copies of the (endomorphism-expanded) point table, where copy k contains 2^{k * copy_shift} * P_i for every base
+ * point P_i. A WNAF window w = k * rounds_per_copy + v can then be applied to copy k in "virtual round" v, which folds
+ * `num_copies` windows into a single bucket accumulation. This reduces the number of bucket reductions and doublings
+ * from `num_rounds` to `rounds_per_copy`, and the larger round sizes allow for wider buckets.
+ *
+ * The cost is memory: every copy is as large as the regular pippenger point table.
+ **/
+template <typename Curve> struct fixed_base_point_table {
+    using AffineElement = typename Curve::AffineElement;
+
+    // the number of base points (before the endomorphism split)
+    size_t num_points = 0;
+    // the number of shifted copies of the point table. Zero if the memory budget could not fit at least two copies
+    size_t num_copies = 0;
+    size_t bits_per_bucket = 0;
+    size_t num_rounds = 0;
+    size_t rounds_per_copy = 0;
+    // the distance between two copies in `points`, i.e. the size of one endomorphism-expanded point table
+    size_t copy_stride = 0;
+    std::shared_ptr<AffineElement[]> points;
+
+    fixed_base_point_table() = default;
+    fixed_base_point_table(const AffineElement* point_table, size_t num_base_points, size_t memory_budget);
+
+    bool empty() const { return num_copies == 0; }
+    size_t get_memory_usage() const;
+
+    static size_t get_num_copies(size_t num_base_points, size_t memory_budget);
+};
+
+template <typename Curve>
+typename Curve::Element pippenger_fixed_base(typename Curve::ScalarField* scalars,
+                                             const fixed_base_point_table<Curve>& point_table,
+                                             size_t num_initial_points,
+                                             pippenger_runtime_state<Curve>& state);
+
+extern template struct fixed_base_point_table<curve::BN254>;
+extern template struct fixed_base_point_table<curve::Grumpkin>;
+
+extern template curve::BN254::Element pippenger_fixed_base<curve::BN254>(
+    curve::BN254::ScalarField* scalars,
+    const fixed_base_point_table<curve::BN254>& point_table,
+    size_t num_initial_points,
+    pippenger_runtime_state<curve::BN254>& state);
+
+extern template curve::Grumpkin::Element pippenger_fixed_base<curve::Grumpkin>(
+    curve::Grumpkin::ScalarField* scalars,
+    const fixed_base_point_table<curve::Grumpkin>& point_table,
+    size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state);
+} // namespace barretenberg::scalar_multiplication
@@ -8,19 +8,43 @@
 // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
 namespace barretenberg::scalar_multiplication {
 
-size_t get_num_pippenger_rounds(const size_t num_points)
+/**
+ * The number of rounds to allocate point schedule space for. Every slice of up to `num_points / 2` initial points must
+ * fit, including slices whose tuned bucket width needs more rounds than the heuristic one.
+ **/
+template <typename Curve> size_t get_num_pippenger_rounds(const size_t num_points)
 {
     const auto num_points_floor = static_cast<size_t>(1ULL << (numeric::get_msb(num_points)));
-    const auto num_rounds =
+    auto num_rounds =
         static_cast<size_t>(barretenberg::scalar_multiplication::get_num_rounds(static_cast<size_t>(num_points_floor)));
+    for (size_t slice_points = 1; slice_points <= num_points / 2; slice_points <<= 1) {
+        // all slices with the same msb share a bucket width, the largest of them needs the most schedule space
+        const size_t largest_slice_points = std::min(2 * slice_points - 1, num_points / 2);
+        const size_t slice_rounds = WNAF_SIZE(get_tuned_bucket_width<Curve>(slice_points) + 1);
+        const size_t slice_schedule_size = slice_rounds * 2 * largest_slice_points;
+        num_rounds = std::max(num_rounds, (slice_schedule_size + num_points - 1) / num_points);
+    }
     return num_rounds;
 }
+
+/**
+ * The number of buckets each thread needs space for, given the tuned bucket widths of all slices of up to
+ * `num_initial_points` points
+ **/
+template <typename Curve> size_t get_num_pippenger_buckets(const size_t num_initial_points)
+{
+    size_t bucket_width = get_optimal_bucket_width(num_initial_points);
+    for (size_t slice_points = 1; slice_points <= num_initial_points; slice_points <<= 1) {
+        bucket_width = std::max(bucket_width, get_tuned_bucket_width<Curve>(slice_points));
+    }
+    return 1ULL << bucket_width;
+}
+
 template <typename Curve>
 pippenger_runtime_state<Curve>::pippenger_runtime_state(const size_t num_initial_points) noexcept
     : num_points(num_initial_points * 2)
-    , num_buckets(static_cast<size_t>(1ULL << barretenberg::scalar_multiplication::get_optimal_bucket_width(
-                                          static_cast<size_t>(num_initial_points))))
-    , num_rounds(get_num_pippenger_rounds(static_cast<size_t>(num_points)))
+    , num_buckets(get_num_pippenger_buckets<Curve>(num_initial_points))
+    , num_rounds(get_num_pippenger_rounds<Curve>(static_cast<size_t>(num_points)))
     , num_threads(get_num_cpus_pow2())
     , prefetch_overflow(num_threads * 16)
     , point_schedule_ptr(
@@ -43,12 +67,6 @@ pippenger_runtime_state<Curve>::pippenger_runtime_state(const size_t num_initial
     using Fq = typename Curve::BaseField;
     using AffineElement = typename Curve::AffineElement;
 
-    const auto num_points_floor = static_cast<size_t>(1ULL << (numeric::get_msb(num_points)));
-    const auto num_buckets = static_cast<size_t>(
-        1ULL << barretenberg::scalar_multiplication::get_optimal_bucket_width(static_cast<size_t>(num_initial_points)));
-    const auto num_rounds =
-        static_cast<size_t>(barretenberg::scalar_multiplication::get_num_rounds(static_cast<size_t>(num_points_floor)));
-
     const size_t points_per_thread = static_cast<size_t>(num_points) / num_threads;
     parallel_for(num_threads, [&](size_t i) {
         const size_t thread_offset = i * points_per_thread;
@@ -157,6 +175,10 @@ pippenger_runtime_state<Curve>& pippenger_runtime_state<Curve>::operator=(
     other.round_counts = nullptr;
 
     num_points = other.num_points;
+    num_buckets = other.num_buckets;
+    num_rounds = other.num_rounds;
+    num_threads = other.num_threads;
+    prefetch_overflow = other.prefetch_overflow;
     return *this;
 }
 
@@ -165,8 +187,6 @@ affine_product_runtime_state<Curve> pippenger_runtime_state<Curve>::get_affine_p
     const size_t num_threads, const size_t thread_index)
 {
     const auto points_per_thread = static_cast<size_t>(num_points / num_threads);
-    const auto num_buckets =
-        static_cast<size_t>(1U << scalar_multiplication::get_optimal_bucket_width(static_cast<size_t>(num_points) / 2));
 
     scalar_multiplication::affine_product_runtime_state<Curve> product_state;
 
@@ -179,6 +199,20 @@ affine_product_runtime_state<Curve> pippenger_runtime_state<Curve>::get_affine_p
     return product_state;
 }
 
+/**
+ * The bucket width for a pippenger run over `num_initial_points` points. This is the tuned width if this state has room
+ * for it, and the heuristic one otherwise (e.g. if the bucket width table was changed after the state was constructed)
+ **/
+template <typename Curve> size_t pippenger_runtime_state<Curve>::get_bucket_width(const size_t num_initial_points) const
+{
+    const size_t bucket_width = get_tuned_bucket_width<Curve>(num_initial_points);
+    const size_t schedule_size = WNAF_SIZE(bucket_width + 1) * 2 * num_initial_points;
+    if ((1ULL << bucket_width) > num_buckets || schedule_size > num_rounds * static_cast<size_t>(num_points)) {
+        return get_optimal_bucket_width(num_initial_points);
+    }
+    return bucket_width;
+}
+
 template <typename Curve> pippenger_runtime_state<Curve>::~pippenger_runtime_state() noexcept
 {
     if (skew_table != nullptr) {
@@ -3,6 +3,11 @@
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/ecc/groups/wnaf.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
 
 namespace barretenberg::scalar_multiplication {
 // simple helper functions to retrieve pointers to pre-allocated memory for the scalar multiplication algorithm.
@@ -63,6 +68,41 @@ constexpr size_t get_num_rounds(const size_t num_points)
     return WNAF_SIZE(bits_per_bucket + 1);
 }
 
+/**
+ * Overrides of the pippenger bucket widths, indexed by log2 of the number of points (before the endomorphism split).
+ * A width of zero falls back to `get_optimal_bucket_width`. Tables are per curve (see `get_bucket_width_table`) and can
+ * be swapped at runtime to A/B them.
+ *
+ * The tables are all zeros, i.e. every curve uses the heuristic. To tune a machine, generate a table with
+ * `pippenger_calibrate` in benchmark/pippenger_bench and install it with `get_bucket_width_table<Curve>() = ...` at
+ * startup.
+ **/
+struct bucket_width_table {
+    static constexpr size_t MAX_LOG_NUM_POINTS = 32;
+    // the widest width we accept. Wider buckets would not fit into the 24-bit radix sort of `process_buckets`
+    static constexpr size_t MAX_BUCKET_WIDTH = 21;
+    std::array<uint8_t, MAX_LOG_NUM_POINTS> widths{};
+};
+
+/**
+ * The bucket width table used by pippenger over `Curve`. Only modify it while no MSM is running. Runtime states are
+ * sized for the table at construction, states that are too small for a later table fall back to the heuristic.
+ **/
+template <typename Curve> bucket_width_table& get_bucket_width_table()
+{
+    static bucket_width_table table;
+    return table;
+}
+
+template <typename Curve> size_t get_tuned_bucket_width(const size_t num_points)
+{
+    if (num_points == 0) {
+        return get_optimal_bucket_width(num_points);
+    }
+    const size_t width = get_bucket_width_table<Curve>().widths[numeric::get_msb(static_cast<uint64_t>(num_points))];
+    return width == 0 ? get_optimal_bucket_width(num_points) : std::min(width, bucket_width_table::MAX_BUCKET_WIDTH);
+}
+
 template <typename Curve> struct affine_product_runtime_state {
     typename Curve::AffineElement* points;
     typename Curve::AffineElement* point_pairs_1;
@@ -112,6 +152,8 @@ template <typename Curve> struct pippenger_runtime_state {
     pippenger_runtime_state(pippenger_runtime_state& other) = delete;
 
     affine_product_runtime_state<Curve> get_affine_product_runtime_state(size_t num_threads, size_t thread_index);
+
+    size_t get_bucket_width(size_t num_initial_points) const;
 };
 
 extern template struct affine_product_runtime_state<curve::BN254>;
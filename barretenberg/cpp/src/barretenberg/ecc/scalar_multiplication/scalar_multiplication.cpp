@@ -1,13 +1,18 @@
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <memory>
+#include <span>
+#include <vector>
 
+#include "./point_table.hpp"
 #include "./process_buckets.hpp"
 #include "./runtime_states.hpp"
 #include "./scalar_multiplication.hpp"
 
+#include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
@@ -193,21 +198,22 @@ void generate_pippenger_point_table(typename Curve::AffineElement* points,
  * @param round_counts The number of points in each round
  * @param scalars The pointer to the region with initial scalars that need to be converted into WNAF
  * @param num_initial_points The number of points before the endomorphism split
+ * @param bits_per_bucket The bucket width. The WNAF window is one bit wider than this (the extra bit is the sign)
  **/
 template <typename Curve>
 void compute_wnaf_states(uint64_t* point_schedule,
                          bool* input_skew_table,
                          uint64_t* round_counts,
                          const typename Curve::ScalarField* scalars,
-                         const size_t num_initial_points)
+                         const size_t num_initial_points,
+                         const size_t bits_per_bucket)
 {
     using Fr = typename Curve::ScalarField;
     const size_t num_points = num_initial_points * 2;
     constexpr size_t MAX_NUM_ROUNDS = 256;
     constexpr size_t MAX_NUM_THREADS = 128;
-    const size_t num_rounds = get_num_rounds(num_points);
-    const size_t bits_per_bucket = get_optimal_bucket_width(num_initial_points);
     const size_t wnaf_bits = bits_per_bucket + 1;
+    const size_t num_rounds = WNAF_SIZE(wnaf_bits);
     const size_t num_threads = get_num_cpus_pow2();
     const size_t num_initial_points_per_thread = num_initial_points / num_threads;
     const size_t num_points_per_thread = num_points / num_threads;
@@ -256,23 +262,43 @@ void compute_wnaf_states(uint64_t* point_schedule,
     }
 }
 
+template <typename Curve>
+void compute_wnaf_states(uint64_t* point_schedule,
+                         bool* input_skew_table,
+                         uint64_t* round_counts,
+                         const typename Curve::ScalarField* scalars,
+                         const size_t num_initial_points)
+{
+    compute_wnaf_states<Curve>(point_schedule,
+                               input_skew_table,
+                               round_counts,
+                               scalars,
+                               num_initial_points,
+                               get_optimal_bucket_width(num_initial_points));
+}
+
 /**
  *  Sorts our wnaf entries in increasing bucket order (per round).
  *  We currently don't multi-thread the inner sorting algorithm, and just split our threads over the number of rounds.
  *  A multi-threaded sorting algorithm could be more efficient, but the total runtime of `organize_buckets` is <5% of
  *  pippenger's runtime, so not a priority.
  **/
-void organize_buckets(uint64_t* point_schedule, const size_t num_points)
+void organize_buckets(uint64_t* point_schedule,
+                      const size_t num_points,
+                      const size_t num_rounds,
+                      const size_t bits_per_bucket)
 {
-    const size_t num_rounds = get_num_rounds(num_points);
-
     parallel_for(num_rounds, [&](size_t i) {
-        scalar_multiplication::process_buckets(&point_schedule[i * num_points],
-                                               num_points,
-                                               static_cast<uint32_t>(get_optimal_bucket_width(num_points / 2)) + 1);
+        scalar_multiplication::process_buckets(
+            &point_schedule[i * num_points], num_points, static_cast<uint32_t>(bits_per_bucket) + 1);
     });
 }
 
+void organize_buckets(uint64_t* point_schedule, const size_t num_points)
+{
+    organize_buckets(point_schedule, num_points, get_num_rounds(num_points), get_optimal_bucket_width(num_points / 2));
+}
+
 /**
  * adds a bunch of points together using affine addition formulae.
  * Paradoxically, the affine formula is crazy efficient if you have a lot of independent point additions to perform.
@@ -745,9 +771,11 @@ typename Curve::Element evaluate_pippenger_rounds(pippenger_runtime_state<Curve>
 {
     using Element = typename Curve::Element;
     using AffineElement = typename Curve::AffineElement;
-    const size_t num_rounds = get_num_rounds(num_points);
-    const size_t num_threads = get_num_cpus_pow2();
-    const size_t bits_per_bucket = get_optimal_bucket_width(num_points / 2);
+    const size_t bits_per_bucket = state.get_bucket_width(num_points / 2);
+    const size_t num_rounds = WNAF_SIZE(bits_per_bucket + 1);
+    // the state's scratch space is split between at most the threads it was created for (e.g. in a smaller
+    // ExecutionContext)
+    const size_t num_threads = std::min(get_num_cpus_pow2(), state.num_threads);
 
     std::unique_ptr<Element[], decltype(&aligned_free)> thread_accumulators(
         static_cast<Element*>(aligned_alloc(64, num_threads * sizeof(Element))), &aligned_free);
@@ -861,9 +889,10 @@ typename Curve::Element pippenger_internal(typename Curve::AffineElement* points
                                            pippenger_runtime_state<Curve>& state,
                                            bool handle_edge_cases)
 {
-    // multiplication_runtime_state state;
-    compute_wnaf_states<Curve>(state.point_schedule, state.skew_table, state.round_counts, scalars, num_initial_points);
-    organize_buckets(state.point_schedule, num_initial_points * 2);
+    const size_t bits_per_bucket = state.get_bucket_width(num_initial_points);
+    compute_wnaf_states<Curve>(
+        state.point_schedule, state.skew_table, state.round_counts, scalars, num_initial_points, bits_per_bucket);
+    organize_buckets(state.point_schedule, num_initial_points * 2, WNAF_SIZE(bits_per_bucket + 1), bits_per_bucket);
     typename Curve::Element result =
         evaluate_pippenger_rounds<Curve>(state, points, num_initial_points * 2, handle_edge_cases);
     return result;
@@ -944,6 +973,388 @@ typename Curve::Element pippenger_unsafe(typename Curve::ScalarField* scalars,
     return pippenger(scalars, points, num_initial_points, state, false);
 }
 
+/**
+ * `pippenger_unsafe` for scalar vectors that are mostly zero, e.g. commitments to selectors or to the ecc op wires.
+ *
+ * Zero scalars are skipped and scalars equal to one are added directly. The remaining entries, along with their
+ * (endomorphism-expanded) points, are compacted into a temporary table, so pippenger only runs over the non-trivial
+ * scalars. The cost is two passes over the scalars and one copy of the non-trivial points, so this is only worth it if
+ * a good fraction of the scalars is trivial.
+ **/
+template <typename Curve>
+typename Curve::Element pippenger_sparse_unsafe(typename Curve::ScalarField* scalars,
+                                                typename Curve::AffineElement* points,
+                                                const size_t num_initial_points,
+                                                pippenger_runtime_state<Curve>& state)
+{
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    const size_t num_threads = get_num_cpus();
+    const size_t points_per_thread = (num_initial_points + num_threads - 1) / num_threads;
+    const auto get_thread_range = [&](const size_t thread_index) {
+        const size_t start = std::min(thread_index * points_per_thread, num_initial_points);
+        const size_t end = std::min(start + points_per_thread, num_initial_points);
+        return std::make_pair(start, end);
+    };
+
+    // count the non-trivial scalars, and add up the points whose scalar is one
+    std::vector<size_t> thread_offsets(num_threads + 1, 0);
+    std::vector<Element> thread_sums(num_threads);
+    parallel_for(num_threads, [&](size_t j) {
+        const auto [start, end] = get_thread_range(j);
+        thread_sums[j].self_set_infinity();
+        size_t count = 0;
+        for (size_t i = start; i < end; ++i) {
+            if (scalars[i].is_zero()) {
+                continue;
+            }
+            if (scalars[i] == Fr::one()) {
+                thread_sums[j] += points[2 * i];
+            } else {
+                ++count;
+            }
+        }
+        thread_offsets[j + 1] = count;
+    });
+    for (size_t j = 0; j < num_threads; ++j) {
+        thread_offsets[j + 1] += thread_offsets[j];
+    }
+
+    Element result;
+    result.self_set_infinity();
+    for (const auto& thread_sum : thread_sums) {
+        result += thread_sum;
+    }
+    const size_t num_sparse_points = thread_offsets[num_threads];
+    if (num_sparse_points == 0) {
+        return result;
+    }
+
+    std::vector<Fr> sparse_scalars(num_sparse_points);
+    auto sparse_points = point_table_alloc<AffineElement>(num_sparse_points);
+    parallel_for(num_threads, [&](size_t j) {
+        const auto [start, end] = get_thread_range(j);
+        size_t sparse_index = thread_offsets[j];
+        for (size_t i = start; i < end; ++i) {
+            if (scalars[i].is_zero() || scalars[i] == Fr::one()) {
+                continue;
+            }
+            sparse_scalars[sparse_index] = scalars[i];
+            sparse_points.get()[2 * sparse_index] = points[2 * i];
+            sparse_points.get()[2 * sparse_index + 1] = points[2 * i + 1];
+            ++sparse_index;
+        }
+    });
+    result += pippenger_unsafe<Curve>(&sparse_scalars[0], sparse_points.get(), num_sparse_points, state);
+    return result;
+}
+
+/**
+ * Evaluate the bucket sums of a merged schedule produced by `pippenger_batch_internal`.
+ *
+ * This is `evaluate_pippenger_rounds`, except that the buckets of MSM m occupy the bucket range [m * num_buckets,
+ * (m + 1) * num_buckets) of every round. A thread's bucket range can span several MSMs, so the running sum is restarted
+ * at every MSM boundary and each thread keeps one accumulator per MSM.
+ **/
+template <typename Curve>
+std::vector<typename Curve::Element> evaluate_pippenger_batch_rounds(pippenger_runtime_state<Curve>& state,
+                                                                     typename Curve::AffineElement* points,
+                                                                     const std::vector<size_t>& point_offsets,
+                                                                     const size_t num_msm_points,
+                                                                     const size_t bits_per_bucket)
+{
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    const size_t num_msms = point_offsets.size();
+    const size_t num_points = num_msm_points * num_msms * 2;
+    const size_t num_rounds = WNAF_SIZE(bits_per_bucket + 1);
+    const size_t num_buckets = 1ULL << bits_per_bucket;
+    // the state's scratch space is split between at most the threads it was created for (e.g. in a smaller
+    // ExecutionContext)
+    const size_t num_threads = std::min(get_num_cpus_pow2(), state.num_threads);
+
+    std::vector<Element> thread_accumulators(num_threads * num_msms);
+
+    parallel_for(num_threads, [&](size_t j) {
+        Element* accumulators = &thread_accumulators[j * num_msms];
+        std::vector<Element> round_accumulators(num_msms);
+        for (size_t m = 0; m < num_msms; ++m) {
+            accumulators[m].self_set_infinity();
+        }
+
+        for (size_t i = 0; i < num_rounds; ++i) {
+            for (size_t m = 0; m < num_msms; ++m) {
+                round_accumulators[m].self_set_infinity();
+            }
+
+            const uint64_t num_round_points = state.round_counts[i];
+            if ((num_round_points != 0) && (num_round_points >= num_threads || j == num_threads - 1)) {
+                const uint64_t num_round_points_per_thread = num_round_points / num_threads;
+                const uint64_t leftovers =
+                    (j == num_threads - 1) ? (num_round_points) - (num_round_points_per_thread * num_threads) : 0;
+
+                uint64_t* thread_point_schedule =
+                    &state.point_schedule[(i * num_points) + j * num_round_points_per_thread];
+                const size_t first_bucket = thread_point_schedule[0] & 0x7fffffffU;
+                const size_t last_bucket =
+                    thread_point_schedule[(num_round_points_per_thread - 1 + leftovers)] & 0x7fffffffU;
+
+                affine_product_runtime_state<Curve> product_state =
+                    state.get_affine_product_runtime_state(num_threads, j);
+                product_state.num_points = static_cast<uint32_t>(num_round_points_per_thread + leftovers);
+                product_state.points = points;
+                product_state.point_schedule = thread_point_schedule;
+                product_state.num_buckets = static_cast<uint32_t>((last_bucket - first_bucket) + 1);
+                AffineElement* output_buckets = reduce_buckets(product_state, true, false);
+
+                // walk the buckets from the top down, one MSM segment at a time
+                size_t output_it = product_state.num_points - 1;
+                size_t segment_hi = last_bucket + 1;
+                while (segment_hi > first_bucket) {
+                    const size_t msm = (segment_hi - 1) / num_buckets;
+                    const size_t segment_lo = std::max(first_bucket, msm * num_buckets);
+
+                    Element running_sum;
+                    Element accumulator;
+                    running_sum.self_set_infinity();
+                    accumulator.self_set_infinity();
+                    for (size_t bucket = segment_hi; bucket-- > segment_lo;) {
+                        if (!product_state.bucket_empty_status[bucket - first_bucket]) {
+                            running_sum += output_buckets[output_it];
+                            --output_it;
+                        }
+                        if (bucket > segment_lo) {
+                            accumulator += running_sum;
+                        }
+                    }
+                    // accumulator = ∑ (b - lo)⋅B_b and running_sum = ∑ B_b, so ∑ (2b + 1)⋅B_b is
+                    // 2⋅accumulator + running_sum + 2⋅lo⋅running_sum
+                    const size_t lo = segment_lo - msm * num_buckets;
+                    accumulator.self_dbl();
+                    accumulator += running_sum;
+                    if (lo > 0) {
+                        accumulator += small_scalar_mul(running_sum, static_cast<uint64_t>(lo) << 1ULL);
+                    }
+                    round_accumulators[msm] += accumulator;
+                    segment_hi = segment_lo;
+                }
+            }
+
+            if (i == (num_rounds - 1)) {
+                const size_t num_points_per_thread = num_points / num_threads;
+                const bool* skew_table = &state.skew_table[j * num_points_per_thread];
+                for (size_t k = 0; k < num_points_per_thread; ++k) {
+                    if (skew_table[k]) {
+                        const size_t point_index = j * num_points_per_thread + k;
+                        const size_t msm = point_index / (2 * num_msm_points);
+                        const size_t msm_point_index = point_index - msm * 2 * num_msm_points;
+                        round_accumulators[msm] += -points[2 * point_offsets[msm] + msm_point_index];
+                    }
+                }
+            }
+
+            for (size_t m = 0; m < num_msms; ++m) {
+                if (i > 0) {
+                    for (size_t k = 0; k < bits_per_bucket + 1; ++k) {
+                        accumulators[m].self_dbl();
+                    }
+                }
+                accumulators[m] += round_accumulators[m];
+            }
+        }
+    });
+
+    std::vector<Element> results(num_msms);
+    for (size_t m = 0; m < num_msms; ++m) {
+        results[m].self_set_infinity();
+        for (size_t j = 0; j < num_threads; ++j) {
+            results[m] += thread_accumulators[j * num_msms + m];
+        }
+    }
+    return results;
+}
+
+/**
+ * Evaluate several MSMs of `num_msm_points` points each as a single pippenger run. MSM m multiplies `scalars[m]` with
+ * the points starting at `point_offsets[m]`.
+ *
+ * The scalars are decomposed as one concatenated WNAF schedule, and each MSM's bucket indices are shifted into their
+ * own bucket range. Every round is then sorted and reduced once for all MSMs, so the threads are split across all of
+ * them instead of synchronising once per MSM.
+ **/
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_batch_internal(
+    typename Curve::AffineElement* points,
+    const std::vector<const typename Curve::ScalarField*>& scalars,
+    const std::vector<size_t>& point_offsets,
+    const size_t num_msm_points,
+    pippenger_runtime_state<Curve>& state)
+{
+    using Fr = typename Curve::ScalarField;
+    const size_t num_msms = scalars.size();
+    const size_t num_points = num_msm_points * num_msms * 2;
+    const size_t bits_per_bucket = state.get_bucket_width(num_msm_points);
+    const size_t num_rounds = WNAF_SIZE(bits_per_bucket + 1);
+    const size_t num_buckets = 1ULL << bits_per_bucket;
+
+    std::vector<Fr> batch_scalars(num_msm_points * num_msms);
+    parallel_for(num_msms, [&](size_t m) {
+        std::copy(scalars[m], scalars[m] + num_msm_points, &batch_scalars[m * num_msm_points]);
+    });
+    compute_wnaf_states<Curve>(state.point_schedule,
+                               state.skew_table,
+                               state.round_counts,
+                               &batch_scalars[0],
+                               num_msm_points * num_msms,
+                               bits_per_bucket);
+
+    // Point indices in the schedule refer to the concatenated scalars. Map them back onto the point table, and move
+    // each MSM's buckets into its own bucket range. Empty entries (all bits set) are left alone so they still sort last
+    parallel_for(num_rounds * num_msms, [&](size_t i) {
+        const size_t round = i / num_msms;
+        const size_t msm = i % num_msms;
+        const uint64_t point_shift = static_cast<uint64_t>(2 * point_offsets[msm] - 2 * msm * num_msm_points) << 32ULL;
+        const uint64_t bucket_shift = static_cast<uint64_t>(msm * num_buckets);
+        uint64_t* schedule = &state.point_schedule[round * num_points + msm * 2 * num_msm_points];
+        for (size_t k = 0; k < 2 * num_msm_points; ++k) {
+            if (schedule[k] != 0xffffffffffffffffULL) {
+                schedule[k] += point_shift + bucket_shift;
+            }
+        }
+    });
+    const size_t msm_bits = static_cast<size_t>(numeric::get_msb(static_cast<uint64_t>(num_msms - 1))) + 1;
+    organize_buckets(state.point_schedule, num_points, num_rounds, bits_per_bucket + msm_bits);
+
+    return evaluate_pippenger_batch_rounds<Curve>(state, points, point_offsets, num_msm_points, bits_per_bucket);
+}
+
+/**
+ * Compute several MSMs over the same point table, e.g. commitments to several polynomials against one SRS.
+ * The i-th result is ∑ⱼ scalars[i][j]⋅points[2(oᵢ + j)], where the oᵢ are the `point_offsets` (all zero if empty).
+ *
+ * Like `pippenger`, every MSM is split into power-of-two slices. Slices of equal size are merged into a single
+ * pippenger run (see `pippenger_batch_internal`) as long as their combined schedule fits into `state`, and slices that
+ * are too small for pippenger share a single parallel Strauss pass. `state` must be large enough for any single MSM.
+ * The same caveats as for `pippenger_unsafe` apply.
+ **/
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_batch_unsafe(
+    std::span<const std::span<const typename Curve::ScalarField>> scalars,
+    typename Curve::AffineElement* points,
+    pippenger_runtime_state<Curve>& state,
+    std::span<const size_t> point_offsets)
+{
+    using Element = typename Curve::Element;
+    using Fr = typename Curve::ScalarField;
+
+    const size_t num_msms = scalars.size();
+    ASSERT(point_offsets.empty() || point_offsets.size() == num_msms);
+    const auto first_point = [&](size_t m) { return point_offsets.empty() ? 0 : point_offsets[m]; };
+    const size_t threshold = get_num_cpus_pow2() * 8;
+    const size_t max_num_points = static_cast<size_t>(state.num_points) / 2;
+
+    std::vector<Element> results(num_msms);
+    std::vector<size_t> offsets(num_msms, 0);
+    for (size_t m = 0; m < num_msms; ++m) {
+        ASSERT(scalars[m].size() <= max_num_points);
+        results[m].self_set_infinity();
+    }
+
+    while (true) {
+        // the (msm, number of points) slices of this iteration. Each MSM contributes its largest power-of-two slice
+        std::vector<std::pair<size_t, size_t>> slices;
+        std::vector<size_t> strauss_msms;
+        for (size_t m = 0; m < num_msms; ++m) {
+            const size_t remaining = scalars[m].size() - offsets[m];
+            if (remaining == 0) {
+                continue;
+            }
+            if (remaining <= threshold) {
+                strauss_msms.push_back(m);
+            } else {
+                slices.emplace_back(m, 1ULL << numeric::get_msb(static_cast<uint64_t>(remaining)));
+            }
+        }
+        if (slices.empty() && strauss_msms.empty()) {
+            break;
+        }
+
+        if (!strauss_msms.empty()) {
+            std::vector<size_t> product_offsets(strauss_msms.size() + 1, 0);
+            for (size_t k = 0; k < strauss_msms.size(); ++k) {
+                const size_t m = strauss_msms[k];
+                product_offsets[k + 1] = product_offsets[k] + scalars[m].size() - offsets[m];
+            }
+            std::vector<Element> products(product_offsets.back());
+            parallel_for(products.size(), [&](size_t i) {
+                const auto k = static_cast<size_t>(
+                    std::upper_bound(product_offsets.begin(), product_offsets.end(), i) - product_offsets.begin() - 1);
+                const size_t m = strauss_msms[k];
+                const size_t point_index = offsets[m] + i - product_offsets[k];
+                products[i] = Element(points[(first_point(m) + point_index) * 2]) * scalars[m][point_index];
+            });
+            for (size_t k = 0; k < strauss_msms.size(); ++k) {
+                const size_t m = strauss_msms[k];
+                for (size_t i = product_offsets[k]; i < product_offsets[k + 1]; ++i) {
+                    results[m] += products[i];
+                }
+                offsets[m] = scalars[m].size();
+            }
+        }
+
+        // group equal slice sizes, so that they can share a single pippenger run
+        std::stable_sort(
+            slices.begin(), slices.end(), [](const auto& a, const auto& b) { return a.second > b.second; });
+        size_t slice_it = 0;
+        while (slice_it < slices.size()) {
+            const size_t num_msm_points = slices[slice_it].second;
+            // The merged run needs a schedule of num_rounds * 2 * num_points entries, and every thread must be able
+            // to hold the buckets of all merged MSMs (a thread's bucket range can cover all of them)
+            const size_t bits_per_bucket = state.get_bucket_width(num_msm_points);
+            const size_t schedule_size = WNAF_SIZE(bits_per_bucket + 1) * 2 * num_msm_points;
+            const size_t max_batch_size =
+                std::max(std::min({ max_num_points / num_msm_points,
+                                    (state.num_rounds * static_cast<size_t>(state.num_points)) / schedule_size,
+                                    state.num_buckets >> bits_per_bucket }),
+                         static_cast<size_t>(1));
+
+            std::vector<const Fr*> batch_scalars;
+            std::vector<size_t> batch_offsets;
+            std::vector<size_t> batch_msms;
+            while (slice_it < slices.size() && slices[slice_it].second == num_msm_points &&
+                   batch_msms.size() < max_batch_size) {
+                const size_t m = slices[slice_it].first;
+                batch_scalars.push_back(&scalars[m][offsets[m]]);
+                batch_offsets.push_back(first_point(m) + offsets[m]);
+                batch_msms.push_back(m);
+                ++slice_it;
+            }
+
+            if (batch_msms.size() == 1) {
+                const size_t m = batch_msms[0];
+                results[m] += pippenger_internal<Curve>(
+                    points + 2 * (first_point(m) + offsets[m]),
+                    const_cast<Fr*>(batch_scalars[0]),
+                    num_msm_points,
+                    state,
+                    false);
+            } else {
+                const std::vector<Element> batch_results =
+                    pippenger_batch_internal<Curve>(points, batch_scalars, batch_offsets, num_msm_points, state);
+                for (size_t k = 0; k < batch_msms.size(); ++k) {
+                    results[batch_msms[k]] += batch_results[k];
+                }
+            }
+            for (const size_t m : batch_msms) {
+                offsets[m] += num_msm_points;
+            }
+        }
+    }
+    return results;
+}
+
 template <typename Curve>
 typename Curve::Element pippenger_without_endomorphism_basis_points(typename Curve::ScalarField* scalars,
                                                                     typename Curve::AffineElement* points,
@@ -961,6 +1372,19 @@ template void generate_pippenger_point_table<curve::BN254>(curve::BN254::AffineE
                                                            curve::BN254::AffineElement* table,
                                                            size_t num_points);
 
+template void compute_wnaf_states<curve::BN254>(uint64_t* point_schedule,
+                                                bool* input_skew_table,
+                                                uint64_t* round_counts,
+                                                const curve::BN254::ScalarField* scalars,
+                                                const size_t num_initial_points);
+
+template void compute_wnaf_states<curve::BN254>(uint64_t* point_schedule,
+                                                bool* input_skew_table,
+                                                uint64_t* round_counts,
+                                                const curve::BN254::ScalarField* scalars,
+                                                const size_t num_initial_points,
+                                                const size_t bits_per_bucket);
+
 template uint32_t construct_addition_chains<curve::BN254>(affine_product_runtime_state<curve::BN254>& state,
                                                           bool empty_bucket_counts = true);
 
@@ -1001,6 +1425,17 @@ template curve::BN254::Element pippenger_unsafe<curve::BN254>(curve::BN254::Scal
                                                               const size_t num_initial_points,
                                                               pippenger_runtime_state<curve::BN254>& state);
 
+template curve::BN254::Element pippenger_sparse_unsafe<curve::BN254>(curve::BN254::ScalarField* scalars,
+                                                                     curve::BN254::AffineElement* points,
+                                                                     const size_t num_initial_points,
+                                                                     pippenger_runtime_state<curve::BN254>& state);
+
+template std::vector<curve::BN254::Element> pippenger_batch_unsafe<curve::BN254>(
+    std::span<const std::span<const curve::BN254::ScalarField>> scalars,
+    curve::BN254::AffineElement* points,
+    pippenger_runtime_state<curve::BN254>& state,
+    std::span<const size_t> point_offsets);
+
 template curve::BN254::Element pippenger_without_endomorphism_basis_points<curve::BN254>(
     curve::BN254::ScalarField* scalars,
     curve::BN254::AffineElement* points,
@@ -1012,6 +1447,19 @@ template void generate_pippenger_point_table<curve::Grumpkin>(curve::Grumpkin::A
                                                               curve::Grumpkin::AffineElement* table,
                                                               size_t num_points);
 
+template void compute_wnaf_states<curve::Grumpkin>(uint64_t* point_schedule,
+                                                   bool* input_skew_table,
+                                                   uint64_t* round_counts,
+                                                   const curve::Grumpkin::ScalarField* scalars,
+                                                   const size_t num_initial_points);
+
+template void compute_wnaf_states<curve::Grumpkin>(uint64_t* point_schedule,
+                                                   bool* input_skew_table,
+                                                   uint64_t* round_counts,
+                                                   const curve::Grumpkin::ScalarField* scalars,
+                                                   const size_t num_initial_points,
+                                                   const size_t bits_per_bucket);
+
 template uint32_t construct_addition_chains<curve::Grumpkin>(affine_product_runtime_state<curve::Grumpkin>& state,
                                                              bool empty_bucket_counts = true);
 
@@ -1052,6 +1500,18 @@ template curve::Grumpkin::Element pippenger_unsafe<curve::Grumpkin>(curve::Grump
                                                                     const size_t num_initial_points,
                                                                     pippenger_runtime_state<curve::Grumpkin>& state);
 
+template curve::Grumpkin::Element pippenger_sparse_unsafe<curve::Grumpkin>(
+    curve::Grumpkin::ScalarField* scalars,
+    curve::Grumpkin::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state);
+
+template std::vector<curve::Grumpkin::Element> pippenger_batch_unsafe<curve::Grumpkin>(
+    std::span<const std::span<const curve::Grumpkin::ScalarField>> scalars,
+    curve::Grumpkin::AffineElement* points,
+    pippenger_runtime_state<curve::Grumpkin>& state,
+    std::span<const size_t> point_offsets);
+
 template curve::Grumpkin::Element pippenger_without_endomorphism_basis_points<curve::Grumpkin>(
     curve::Grumpkin::ScalarField* scalars,
     curve::Grumpkin::AffineElement* points,
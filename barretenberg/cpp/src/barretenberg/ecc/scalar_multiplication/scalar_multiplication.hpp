@@ -3,8 +3,11 @@
 #include "./runtime_states.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
 #include <cstddef>
 #include <cstdint>
+#include <span>
+#include <vector>
 
 namespace barretenberg::scalar_multiplication {
 
@@ -92,6 +95,14 @@ void compute_wnaf_states(uint64_t* point_schedule,
                          const typename Curve::ScalarField* scalars,
                          size_t num_initial_points);
 
+template <typename Curve>
+void compute_wnaf_states(uint64_t* point_schedule,
+                         bool* input_skew_table,
+                         uint64_t* round_counts,
+                         const typename Curve::ScalarField* scalars,
+                         size_t num_initial_points,
+                         size_t bits_per_bucket);
+
 template <typename Curve>
 void generate_pippenger_point_table(typename Curve::AffineElement* points,
                                     typename Curve::AffineElement* table,
@@ -99,6 +110,8 @@ void generate_pippenger_point_table(typename Curve::AffineElement* points,
 
 void organize_buckets(uint64_t* point_schedule, size_t num_points);
 
+void organize_buckets(uint64_t* point_schedule, size_t num_points, size_t num_rounds, size_t bits_per_bucket);
+
 inline void count_bits(const uint32_t* bucket_counts,
                        uint32_t* bit_offsets,
                        const uint32_t num_buckets,
@@ -116,6 +129,25 @@ inline void count_bits(const uint32_t* bucket_counts,
     }
 }
 
+/**
+ * Compute `multiplier * point` for small multipliers, e.g. to offset bucket indices, with a simple double-and-add.
+ **/
+template <typename Element> Element small_scalar_mul(const Element& point, const uint64_t multiplier)
+{
+    Element result;
+    result.self_set_infinity();
+    if (multiplier == 0) {
+        return result;
+    }
+    for (size_t shift = numeric::get_msb(multiplier) + 1; shift > 0; --shift) {
+        result.self_dbl();
+        if (((multiplier >> (shift - 1)) & 1ULL) == 1ULL) {
+            result += point;
+        }
+    }
+    return result;
+}
+
 template <typename Curve>
 uint32_t construct_addition_chains(affine_product_runtime_state<Curve>& state, bool empty_bucket_counts = true);
 
@@ -164,6 +196,19 @@ typename Curve::Element pippenger_unsafe(typename Curve::ScalarField* scalars,
                                          size_t num_initial_points,
                                          pippenger_runtime_state<Curve>& state);
 
+template <typename Curve>
+typename Curve::Element pippenger_sparse_unsafe(typename Curve::ScalarField* scalars,
+                                                typename Curve::AffineElement* points,
+                                                size_t num_initial_points,
+                                                pippenger_runtime_state<Curve>& state);
+
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_batch_unsafe(
+    std::span<const std::span<const typename Curve::ScalarField>> scalars,
+    typename Curve::AffineElement* points,
+    pippenger_runtime_state<Curve>& state,
+    std::span<const size_t> point_offsets = {});
+
 template <typename Curve>
 typename Curve::Element pippenger_without_endomorphism_basis_points(typename Curve::ScalarField* scalars,
                                                                     typename Curve::AffineElement* points,
@@ -177,6 +222,19 @@ extern template void generate_pippenger_point_table<curve::BN254>(curve::BN254::
                                                                   curve::BN254::AffineElement* table,
                                                                   size_t num_points);
 
+extern template void compute_wnaf_states<curve::BN254>(uint64_t* point_schedule,
+                                                       bool* input_skew_table,
+                                                       uint64_t* round_counts,
+                                                       const curve::BN254::ScalarField* scalars,
+                                                       size_t num_initial_points);
+
+extern template void compute_wnaf_states<curve::BN254>(uint64_t* point_schedule,
+                                                       bool* input_skew_table,
+                                                       uint64_t* round_counts,
+                                                       const curve::BN254::ScalarField* scalars,
+                                                       size_t num_initial_points,
+                                                       size_t bits_per_bucket);
+
 extern template uint32_t construct_addition_chains<curve::BN254>(affine_product_runtime_state<curve::BN254>& state,
                                                                  bool empty_bucket_counts = true);
 
@@ -217,6 +275,18 @@ extern template curve::BN254::Element pippenger_unsafe<curve::BN254>(curve::BN25
                                                                      const size_t num_initial_points,
                                                                      pippenger_runtime_state<curve::BN254>& state);
 
+extern template curve::BN254::Element pippenger_sparse_unsafe<curve::BN254>(
+    curve::BN254::ScalarField* scalars,
+    curve::BN254::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::BN254>& state);
+
+extern template std::vector<curve::BN254::Element> pippenger_batch_unsafe<curve::BN254>(
+    std::span<const std::span<const curve::BN254::ScalarField>> scalars,
+    curve::BN254::AffineElement* points,
+    pippenger_runtime_state<curve::BN254>& state,
+    std::span<const size_t> point_offsets);
+
 extern template curve::BN254::Element pippenger_without_endomorphism_basis_points<curve::BN254>(
     curve::BN254::ScalarField* scalars,
     curve::BN254::AffineElement* points,
@@ -229,6 +299,19 @@ extern template void generate_pippenger_point_table<curve::Grumpkin>(curve::Grum
                                                                      curve::Grumpkin::AffineElement* table,
                                                                      size_t num_points);
 
+extern template void compute_wnaf_states<curve::Grumpkin>(uint64_t* point_schedule,
+                                                          bool* input_skew_table,
+                                                          uint64_t* round_counts,
+                                                          const curve::Grumpkin::ScalarField* scalars,
+                                                          size_t num_initial_points);
+
+extern template void compute_wnaf_states<curve::Grumpkin>(uint64_t* point_schedule,
+                                                          bool* input_skew_table,
+                                                          uint64_t* round_counts,
+                                                          const curve::Grumpkin::ScalarField* scalars,
+                                                          size_t num_initial_points,
+                                                          size_t bits_per_bucket);
+
 extern template uint32_t construct_addition_chains<curve::Grumpkin>(
     affine_product_runtime_state<curve::Grumpkin>& state, bool empty_bucket_counts = true);
 
@@ -271,6 +354,18 @@ extern template curve::Grumpkin::Element pippenger_unsafe<curve::Grumpkin>(
     const size_t num_initial_points,
     pippenger_runtime_state<curve::Grumpkin>& state);
 
+extern template curve::Grumpkin::Element pippenger_sparse_unsafe<curve::Grumpkin>(
+    curve::Grumpkin::ScalarField* scalars,
+    curve::Grumpkin::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state);
+
+extern template std::vector<curve::Grumpkin::Element> pippenger_batch_unsafe<curve::Grumpkin>(
+    std::span<const std::span<const curve::Grumpkin::ScalarField>> scalars,
+    curve::Grumpkin::AffineElement* points,
+    pippenger_runtime_state<curve::Grumpkin>& state,
+    std::span<const size_t> point_offsets);
+
 extern template curve::Grumpkin::Element pippenger_without_endomorphism_basis_points<curve::Grumpkin>(
     curve::Grumpkin::ScalarField* scalars,
     curve::Grumpkin::AffineElement* points,
@@ -122,13 +122,14 @@ class ProvingKey_ : public PrecomputedPolynomials, public WitnessPolynomials {
         PrecomputedPolynomials::circuit_size = circuit_size;
         this->log_circuit_size = numeric::get_msb(circuit_size);
         this->num_public_inputs = num_public_inputs;
-        // Allocate memory for precomputed polynomials
+        // Allocate memory for precomputed polynomials. Many are replaced wholesale by the composer, so their memory is
+        // zeroed pages that only take up space once written to.
         for (auto& poly : PrecomputedPolynomials::get_all()) {
-            poly = Polynomial(circuit_size);
+            poly = Polynomial(circuit_size, 0, circuit_size);
         }
         // Allocate memory for witness polynomials
         for (auto& poly : WitnessPolynomials::get_all()) {
-            poly = Polynomial(circuit_size);
+            poly = Polynomial(circuit_size, 0, circuit_size);
         }
     };
 };
@@ -155,6 +156,63 @@ auto get_unshifted_then_shifted(const auto& all_entities)
     return concatenate(all_entities.get_unshifted(), all_entities.get_shifted());
 };
 
+/**
+ * @brief A block of consecutive rows of the execution trace, stored row-major, i.e. the values of every polynomial at
+ * one row are adjacent.
+ * @details Relations are evaluated one row of values at a time, while the prover polynomials are stored one column at a
+ * time, so gathering each row with ProverPolynomials::get_row reads from dozens of far apart places, a cache miss per
+ * column once the trace is large. A RowBlock is filled a column at a time instead, reading a contiguous run of each
+ * polynomial, and the relations then read whole rows from it.
+ *
+ * @tparam AllValues The flavor's AllValues, i.e. the type of a single row
+ */
+template <typename AllValues> class RowBlock {
+  public:
+    // Enough rows to amortise the per column work of load(), few enough for the block to stay in L2
+    static constexpr size_t DEFAULT_NUM_ROWS = 64;
+
+    explicit RowBlock(size_t capacity = DEFAULT_NUM_ROWS)
+        : rows(capacity)
+    {
+        // The views are built once, as get_all() allocates
+        row_views.reserve(capacity);
+        for (auto& row : rows) {
+            row_views.emplace_back(row.get_all());
+        }
+    }
+    // A copy would view the rows of the original
+    RowBlock(const RowBlock&) = delete;
+    RowBlock& operator=(const RowBlock&) = delete;
+    RowBlock(RowBlock&&) noexcept = default;
+    RowBlock& operator=(RowBlock&&) noexcept = default;
+    ~RowBlock() = default;
+
+    /**
+     * @brief Load rows [start, start + num_rows) of the polynomials, with num_rows at most the capacity.
+     */
+    template <typename Polynomials> void load(const Polynomials& polynomials, size_t start, size_t num_rows)
+    {
+        ASSERT(num_rows <= rows.size());
+        size_ = num_rows;
+        auto columns = polynomials.get_all();
+        for (size_t column_idx = 0; column_idx < columns.size(); ++column_idx) {
+            const auto& column = columns[column_idx];
+            for (size_t i = 0; i < num_rows; ++i) {
+                row_views[i][column_idx] = column[start + i];
+            }
+        }
+    }
+
+    const AllValues& operator[](size_t i) const { return rows[i]; }
+    size_t size() const { return size_; }
+    size_t capacity() const { return rows.size(); }
+
+  private:
+    std::vector<AllValues> rows;
+    std::vector<decltype(std::declval<AllValues&>().get_all())> row_views;
+    size_t size_ = 0;
+};
+
 /**
  * @brief Recursive utility function to find max PARTIAL_RELATION_LENGTH tuples of Relations.
  * @details The "partial length" of a relation is 1 + the degree of the relation, where any challenges used in the
@@ -1,4 +1,5 @@
 #pragma once
+#include "barretenberg/flavor/flavor.hpp"
 #include <typeinfo>
 
 namespace proof_system::honk::logderivative_library {
@@ -33,24 +34,28 @@ void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_para
     auto lookup_relation = Relation();
 
     auto& inverse_polynomial = lookup_relation.template get_inverse_polynomial(polynomials);
-    for (size_t i = 0; i < circuit_size; ++i) {
-        auto row = polynomials.get_row(i);
-        bool has_inverse = lookup_relation.operation_exists_at_row(row);
-        if (!has_inverse) {
-            continue;
+    flavor::RowBlock<typename Flavor::AllValues> row_block;
+    for (size_t block_start = 0; block_start < circuit_size; block_start += row_block.capacity()) {
+        row_block.load(polynomials, block_start, std::min(row_block.capacity(), circuit_size - block_start));
+        for (size_t j = 0; j < row_block.size(); ++j) {
+            const auto& row = row_block[j];
+            bool has_inverse = lookup_relation.operation_exists_at_row(row);
+            if (!has_inverse) {
+                continue;
+            }
+            FF denominator = 1;
+            barretenberg::constexpr_for<0, READ_TERMS, 1>([&]<size_t read_index> {
+                auto denominator_term =
+                    lookup_relation.template compute_read_term<Accumulator, read_index>(row, relation_parameters);
+                denominator *= denominator_term;
+            });
+            barretenberg::constexpr_for<0, WRITE_TERMS, 1>([&]<size_t write_index> {
+                auto denominator_term =
+                    lookup_relation.template compute_write_term<Accumulator, write_index>(row, relation_parameters);
+                denominator *= denominator_term;
+            });
+            inverse_polynomial[block_start + j] = denominator;
         }
-        FF denominator = 1;
-        barretenberg::constexpr_for<0, READ_TERMS, 1>([&]<size_t read_index> {
-            auto denominator_term =
-                lookup_relation.template compute_read_term<Accumulator, read_index>(row, relation_parameters);
-            denominator *= denominator_term;
-        });
-        barretenberg::constexpr_for<0, WRITE_TERMS, 1>([&]<size_t write_index> {
-            auto denominator_term =
-                lookup_relation.template compute_write_term<Accumulator, write_index>(row, relation_parameters);
-            denominator *= denominator_term;
-        });
-        inverse_polynomial[i] = denominator;
     };
 
     // todo might be inverting zero in field bleh bleh
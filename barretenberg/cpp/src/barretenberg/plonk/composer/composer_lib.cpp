@@ -18,22 +18,40 @@ namespace proof_system::plonk {
 void compute_monomial_and_coset_selector_forms(plonk::proving_key* circuit_proving_key,
                                                std::vector<SelectorProperties> selector_properties)
 {
-    for (size_t i = 0; i < selector_properties.size(); i++) {
-        // Compute monomial form of selector polynomial
-        auto selector_poly_lagrange =
-            circuit_proving_key->polynomial_store.get(selector_properties[i].name + "_lagrange");
-        barretenberg::polynomial selector_poly(circuit_proving_key->circuit_size);
-        barretenberg::polynomial_arithmetic::ifft(
-            &selector_poly_lagrange[0], &selector_poly[0], circuit_proving_key->small_domain);
+    // The coset FFTs are batched, to share the roots of unity between them, but only a few at a time, to bound the
+    // memory of the FFT forms that are held before they go into the store
+    constexpr size_t coset_fft_batch_size = 4;
+    for (size_t start = 0; start < selector_properties.size(); start += coset_fft_batch_size) {
+        const size_t end = std::min(start + coset_fft_batch_size, selector_properties.size());
+        std::vector<barretenberg::polynomial> selector_polys;
+        std::vector<barretenberg::polynomial> selector_poly_ffts;
+        for (size_t i = start; i < end; i++) {
+            // Compute monomial form of selector polynomial
+            auto selector_poly_lagrange =
+                circuit_proving_key->polynomial_store.get(selector_properties[i].name + "_lagrange");
+            barretenberg::polynomial selector_poly(circuit_proving_key->circuit_size);
+            barretenberg::polynomial_arithmetic::ifft(
+                &selector_poly_lagrange[0], &selector_poly[0], circuit_proving_key->small_domain);
 
-        // Compute coset FFT of selector polynomial
-        barretenberg::polynomial selector_poly_fft(selector_poly, circuit_proving_key->circuit_size * 4 + 4);
-        selector_poly_fft.coset_fft(circuit_proving_key->large_domain);
+            selector_poly_ffts.emplace_back(selector_poly, circuit_proving_key->circuit_size * 4 + 4);
+            selector_polys.push_back(std::move(selector_poly));
+        }
+
+        // Compute coset FFTs of the selector polynomials
+        std::vector<barretenberg::fr*> coset_fft_coefficients;
+        for (auto& selector_poly_fft : selector_poly_ffts) {
+            coset_fft_coefficients.push_back(&selector_poly_fft[0]);
+        }
+        barretenberg::polynomial_arithmetic::batch_coset_fft(coset_fft_coefficients, circuit_proving_key->large_domain);
 
-        // Note: For Standard, the lagrange polynomials could be removed from the store at this point but this
-        // is not the case for Ultra.
-        circuit_proving_key->polynomial_store.put(selector_properties[i].name, std::move(selector_poly));
-        circuit_proving_key->polynomial_store.put(selector_properties[i].name + "_fft", std::move(selector_poly_fft));
+        for (size_t i = start; i < end; i++) {
+            // Note: For Standard, the lagrange polynomials could be removed from the store at this point but this
+            // is not the case for Ultra.
+            circuit_proving_key->polynomial_store.put(selector_properties[i].name,
+                                                      std::move(selector_polys[i - start]));
+            circuit_proving_key->polynomial_store.put(selector_properties[i].name + "_fft",
+                                                      std::move(selector_poly_ffts[i - start]));
+        }
     }
 }
 
@@ -94,6 +94,21 @@ template <typename settings> void ProverBase<settings>::compute_wire_commitments
     transcript.add_element("public_inputs", ::to_buffer(public_wires));
 }
 
+// Queues the coset FFTs of the wires w_{begin + 1}, ..., w_{end}
+template <typename settings> void ProverBase<settings>::queue_wire_ffts(const size_t begin, const size_t end)
+{
+    for (size_t i = begin; i < end; ++i) {
+        std::string wire_tag = "w_" + std::to_string(i + 1);
+        queue.add_to_queue({
+            .work_type = work_queue::WorkType::FFT,
+            .mul_scalars = nullptr,
+            .tag = wire_tag,
+            .constant = barretenberg::fr(0),
+            .index = 0,
+        });
+    }
+}
+
 template <typename settings> void ProverBase<settings>::compute_quotient_commitments()
 {
     // In this method, we compute the commitments to polynomials t_{low}(X), t_{mid}(X) and t_{high}(X).
@@ -148,6 +163,7 @@ template <typename settings> void ProverBase<settings>::compute_quotient_commitm
  * Execute preamble round.
  * - Execute init round
  * - Add randomness to the wire witness polynomials for Honest-Verifier Zero Knowledge.
+ * - Queue the IFFTs of the wires, and their coset FFTs.
  *
  * N.B. Maybe we need to refactor this, since before we execute this function wires are in lagrange basis
  * and after they are in monomial form. This is an inconsistency that can mislead developers.
@@ -222,6 +238,10 @@ template <typename settings> void ProverBase<settings>::execute_preamble_round()
             .index = 0,
         });
     }
+
+    // The coset FFTs of these wires are only needed for the quotient, but they depend on no challenge, so start them
+    // now. The queue runs each after the IFFT of its wire and alongside the others.
+    queue_wire_ffts(0, end);
 }
 
 /**
@@ -273,7 +293,7 @@ template <typename settings> void ProverBase<settings>::execute_first_round()
  * - Apply Fiat-Shamir transform to generate the "eta" challenge
  * - Compute the random_widgets' round commitments that need to be computed at round 2.
  * - If using plookup, we compute some w_4 values here (for gates which access "memory"), and apply blinding factors,
- * before finally committing to w_4.
+ * before finally committing to w_4 and queueing its coset FFT.
  *
  * @tname settings Program settings.
  * */
@@ -317,6 +337,8 @@ template <typename settings> void ProverBase<settings>::execute_second_round()
             .constant = key->circuit_size + 1,
             .index = 0,
         });
+
+        queue_wire_ffts(settings::program_width - 1, settings::program_width);
     }
 }
 
@@ -324,7 +346,8 @@ template <typename settings> void ProverBase<settings>::execute_second_round()
  * Execute third round:
  * - Apply Fiat-Shamir transform on the "beta" challenge
  * - Apply 3rd round random widgets*
- * - FFT the wires.
+ *
+ * The wires were queued for their FFTs as soon as their monomial forms were final, in the preamble and second rounds.
  *
  * *For example, standard composer executes permutation widget for z polynomial construction at this round.
  *
@@ -339,17 +362,6 @@ template <typename settings> void ProverBase<settings>::execute_third_round()
     for (auto& widget : random_widgets) {
         widget->compute_round_commitments(transcript, 3, queue);
     }
-
-    for (size_t i = 0; i < settings::program_width; ++i) {
-        std::string wire_tag = "w_" + std::to_string(i + 1);
-        queue.add_to_queue({
-            .work_type = work_queue::WorkType::FFT,
-            .mul_scalars = nullptr,
-            .tag = wire_tag,
-            .constant = barretenberg::fr(0),
-            .index = 0,
-        });
-    }
 }
 
 /**
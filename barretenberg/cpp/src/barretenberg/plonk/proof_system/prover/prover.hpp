@@ -31,6 +31,7 @@ template <typename settings> class ProverBase {
     void compute_batch_opening_polynomials();
     void compute_wire_commitments();
     void compute_quotient_commitments();
+    void queue_wire_ffts(size_t begin, size_t end);
     void init_quotient_polynomials();
     void compute_opening_elements();
     void add_plookup_memory_records_to_w_4();
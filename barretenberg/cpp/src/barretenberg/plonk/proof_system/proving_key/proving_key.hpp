@@ -10,7 +10,7 @@
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/srs/factories/crs_factory.hpp"
 
-#ifdef __wasm__
+#if defined(__wasm__) || defined(SPILL_POLYNOMIALS)
 #include "barretenberg/proof_system/polynomial_store/polynomial_store_cache.hpp"
 // #include "barretenberg/proof_system/polynomial_store/polynomial_store_wasm.hpp"
 #else
@@ -27,7 +27,7 @@ struct proving_key_data {
     std::vector<uint32_t> recursive_proof_public_input_indices;
     std::vector<uint32_t> memory_read_records;
     std::vector<uint32_t> memory_write_records;
-#ifdef __wasm__
+#if defined(__wasm__) || defined(SPILL_POLYNOMIALS)
     PolynomialStoreCache polynomial_store;
     // PolynomialStoreWasm<barretenberg::fr> polynomial_store;
 #else
@@ -64,7 +64,7 @@ struct proving_key {
     std::vector<uint32_t> memory_read_records;  // Used by UltraPlonkComposer only; for ROM, RAM reads.
     std::vector<uint32_t> memory_write_records; // Used by UltraPlonkComposer only, for RAM writes.
 
-#ifdef __wasm__
+#if defined(__wasm__) || defined(SPILL_POLYNOMIALS)
     PolynomialStoreCache polynomial_store;
     // PolynomialStoreWasm<barretenberg::fr> polynomial_store;
 #else
@@ -1,7 +1,10 @@
 #include "work_queue.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
+#include <algorithm>
+#include <atomic>
 
 namespace proof_system::plonk {
 
@@ -13,6 +16,35 @@ work_queue::work_queue(proving_key* prover_key, transcript::StandardTranscript*
     , work_item_queue()
 {}
 
+std::vector<std::string> work_queue::work_item::get_inputs() const
+{
+    switch (work_type) {
+    case WorkType::FFT:
+    case WorkType::SMALL_FFT:
+        return { tag };
+    case WorkType::IFFT:
+        return { tag + "_lagrange" };
+    default:
+        // The scalars of a scalar multiplication are bound to the item when it is queued
+        return {};
+    }
+}
+
+std::vector<std::string> work_queue::work_item::get_outputs() const
+{
+    switch (work_type) {
+    case WorkType::FFT:
+    case WorkType::SMALL_FFT:
+        return { tag + "_fft" };
+    case WorkType::IFFT:
+        return { tag };
+    case WorkType::SCALAR_MULTIPLICATION:
+        return { PIPPENGER_STATE_LABEL };
+    default:
+        return {};
+    }
+}
+
 work_queue::work_item_info work_queue::get_queued_work_item_info() const
 {
     uint32_t scalar_mul_count = 0;
@@ -201,85 +233,146 @@ void work_queue::add_to_queue(const work_item& item)
 
 void work_queue::process_queue()
 {
-    for (const auto& item : work_item_queue) {
-        switch (item.work_type) {
-        // most expensive op
-        case WorkType::SCALAR_MULTIPLICATION: {
-            // Note: work_item.constant is an Fr type (see SMALL_FFT), but here it is interpreted simply as a size_t
-            auto msm_size = static_cast<size_t>(static_cast<uint256_t>(item.constant));
+    const size_t num_items = work_item_queue.size();
+    std::vector<std::vector<std::string>> inputs(num_items);
+    std::vector<std::vector<std::string>> outputs(num_items);
+    for (size_t i = 0; i < num_items; ++i) {
+        inputs[i] = work_item_queue[i].get_inputs();
+        outputs[i] = work_item_queue[i].get_outputs();
+    }
+    const auto intersects = [](const std::vector<std::string>& a, const std::vector<std::string>& b) {
+        return std::any_of(a.begin(), a.end(), [&](const std::string& label) {
+            return std::find(b.begin(), b.end(), label) != b.end();
+        });
+    };
 
-            ASSERT(msm_size <= key->reference_string->get_monomial_size());
+    // Item j waits for an earlier item i if they touch the same label and at least one of them writes it. Queues hold a
+    // handful of items, so the quadratic scan is nothing next to the items themselves.
+    std::vector<std::vector<size_t>> dependents(num_items);
+    std::vector<std::atomic<size_t>> num_dependencies(num_items);
+    for (size_t j = 0; j < num_items; ++j) {
+        for (size_t i = 0; i < j; ++i) {
+            if (intersects(outputs[i], inputs[j]) || intersects(outputs[i], outputs[j]) ||
+                intersects(inputs[i], outputs[j])) {
+                dependents[i].push_back(j);
+                num_dependencies[j]++;
+            }
+        }
+    }
 
-            barretenberg::g1::affine_element* srs_points = key->reference_string->get_monomial_points();
+    // Guards the proving key's polynomial store and the transcript, which the items share
+    std::mutex mutex;
+    TaskGroup group;
+    std::function<void(size_t)> run_item = [&](size_t i) {
+        group.run([&, i]() {
+            process_item(work_item_queue[i], mutex);
+            // If the item throws, its dependents never run and the group rethrows the exception from wait()
+            for (size_t j : dependents[i]) {
+                if (--num_dependencies[j] == 0) {
+                    run_item(j);
+                }
+            }
+        });
+    };
+    for (size_t i = 0; i < num_items; ++i) {
+        if (num_dependencies[i] == 0) {
+            run_item(i);
+        }
+    }
+    group.wait();
 
-            // Run pippenger multi-scalar multiplication.
-            auto runtime_state = barretenberg::scalar_multiplication::pippenger_runtime_state<curve::BN254>(msm_size);
-            barretenberg::g1::affine_element result(barretenberg::scalar_multiplication::pippenger_unsafe<curve::BN254>(
-                item.mul_scalars.get(), srs_points, msm_size, runtime_state));
+    work_item_queue = std::vector<work_item>();
+}
 
-            transcript->add_element(item.tag, result.to_buffer());
+void work_queue::process_item(const work_item& item, std::mutex& mutex)
+{
+    switch (item.work_type) {
+    // most expensive op
+    case WorkType::SCALAR_MULTIPLICATION: {
+        // Note: work_item.constant is an Fr type (see SMALL_FFT), but here it is interpreted simply as a size_t
+        auto msm_size = static_cast<size_t>(static_cast<uint256_t>(item.constant));
 
-            break;
-        }
-        // Commenting this out as per above.
-        // About 20% of the cost of a scalar multiplication. For WASM, might be a bit more expensive
-        // due to the need to copy memory between web workers
-        // case WorkType::SMALL_FFT: {
-        //     using namespace barretenberg;
-        //     const size_t n = key->circuit_size;
-        //     auto wire = key->polynomial_store.get(item.tag);
-
-        //     polynomial wire_copy(wire, n);
-        //     wire_copy.coset_fft_with_generator_shift(key->small_domain, item.constant);
-
-        //     if (item.index != 0) {
-        //         auto old_wire_fft = key->polynomial_store.get(item.tag + "_fft");
-        //         for (size_t i = 0; i < n; ++i) {
-        //             old_wire_fft[4 * i + item.index] = wire_copy[i];
-        //         }
-        //         old_wire_fft[4 * n + item.index] = wire_copy[0];
-        //         key->polynomial_store.put(item.tag + "_fft", std::move(old_wire_fft));
-        //     } else {
-        //         polynomial wire_fft(4 * n + 4);
-        //         for (size_t i = 0; i < n; ++i) {
-        //             wire_fft[4 * i + item.index] = wire_copy[i];
-        //         }
-        //         key->polynomial_store.put(item.tag + "_fft", std::move(wire_fft));
-        //     }
-        //     break;
-        // }
-        case WorkType::FFT: {
-            using namespace barretenberg;
-            auto wire = key->polynomial_store.get(item.tag);
-            polynomial wire_fft(wire, 4 * key->circuit_size + 4);
-
-            wire_fft.coset_fft(key->large_domain);
-            for (size_t i = 0; i < 4; i++) {
-                wire_fft[4 * key->circuit_size + i] = wire_fft[i];
-            }
+        ASSERT(msm_size <= key->reference_string->get_monomial_size());
 
-            key->polynomial_store.put(item.tag + "_fft", std::move(wire_fft));
+        barretenberg::g1::affine_element* srs_points = key->reference_string->get_monomial_points();
 
-            break;
-        }
-        // 1/4 the cost of an fft (each fft has 1/4 the number of elements)
-        case WorkType::IFFT: {
-            using namespace barretenberg;
-            // retrieve wire in lagrange form
-            auto wire_lagrange = key->polynomial_store.get(item.tag + "_lagrange");
-
-            // Compute wire monomial form via ifft on lagrange form then add it to the store
-            polynomial wire_monomial(key->circuit_size);
-            polynomial_arithmetic::ifft((fr*)&wire_lagrange[0], &wire_monomial[0], key->small_domain);
-            key->polynomial_store.put(item.tag, std::move(wire_monomial));
-
-            break;
+        // Run pippenger multi-scalar multiplication.
+        auto runtime_state = barretenberg::scalar_multiplication::pippenger_runtime_state<curve::BN254>(msm_size);
+        barretenberg::g1::affine_element result(barretenberg::scalar_multiplication::pippenger_unsafe<curve::BN254>(
+            item.mul_scalars.get(), srs_points, msm_size, runtime_state));
+
+        std::lock_guard lock(mutex);
+        transcript->add_element(item.tag, result.to_buffer());
+
+        break;
+    }
+    // Commenting this out as per above.
+    // About 20% of the cost of a scalar multiplication. For WASM, might be a bit more expensive
+    // due to the need to copy memory between web workers
+    // case WorkType::SMALL_FFT: {
+    //     using namespace barretenberg;
+    //     const size_t n = key->circuit_size;
+    //     auto wire = key->polynomial_store.get(item.tag);
+
+    //     polynomial wire_copy(wire, n);
+    //     wire_copy.coset_fft_with_generator_shift(key->small_domain, item.constant);
+
+    //     if (item.index != 0) {
+    //         auto old_wire_fft = key->polynomial_store.get(item.tag + "_fft");
+    //         for (size_t i = 0; i < n; ++i) {
+    //             old_wire_fft[4 * i + item.index] = wire_copy[i];
+    //         }
+    //         old_wire_fft[4 * n + item.index] = wire_copy[0];
+    //         key->polynomial_store.put(item.tag + "_fft", std::move(old_wire_fft));
+    //     } else {
+    //         polynomial wire_fft(4 * n + 4);
+    //         for (size_t i = 0; i < n; ++i) {
+    //             wire_fft[4 * i + item.index] = wire_copy[i];
+    //         }
+    //         key->polynomial_store.put(item.tag + "_fft", std::move(wire_fft));
+    //     }
+    //     break;
+    // }
+    case WorkType::FFT: {
+        using namespace barretenberg;
+        polynomial wire;
+        {
+            std::lock_guard lock(mutex);
+            wire = key->polynomial_store.get(item.tag);
         }
-        default: {
+        polynomial wire_fft(wire, 4 * key->circuit_size + 4);
+
+        wire_fft.coset_fft(key->large_domain);
+        for (size_t i = 0; i < 4; i++) {
+            wire_fft[4 * key->circuit_size + i] = wire_fft[i];
         }
+
+        std::lock_guard lock(mutex);
+        key->polynomial_store.put(item.tag + "_fft", std::move(wire_fft));
+
+        break;
+    }
+    // 1/4 the cost of an fft (each fft has 1/4 the number of elements)
+    case WorkType::IFFT: {
+        using namespace barretenberg;
+        // retrieve wire in lagrange form
+        polynomial wire_lagrange;
+        {
+            std::lock_guard lock(mutex);
+            wire_lagrange = key->polynomial_store.get(item.tag + "_lagrange");
         }
+
+        // Compute wire monomial form via ifft on lagrange form then add it to the store
+        polynomial wire_monomial(key->circuit_size);
+        polynomial_arithmetic::ifft((fr*)&wire_lagrange[0], &wire_monomial[0], key->small_domain);
+        std::lock_guard lock(mutex);
+        key->polynomial_store.put(item.tag, std::move(wire_monomial));
+
+        break;
+    }
+    default: {
+    }
     }
-    work_item_queue = std::vector<work_item>();
 }
 
 std::vector<work_queue::work_item> work_queue::get_queue() const
@@ -2,6 +2,7 @@
 
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
 #include "barretenberg/plonk/transcript/transcript_wrappers.hpp"
+#include <mutex>
 
 namespace proof_system::plonk {
 
@@ -25,6 +26,11 @@ class work_queue {
         std::string tag;
         barretenberg::fr constant;
         const size_t index;
+
+        // The polynomial_store labels the item reads and writes, which order it with respect to the other items of
+        // the queue (see process_queue)
+        std::vector<std::string> get_inputs() const;
+        std::vector<std::string> get_outputs() const;
     };
 
     struct queued_fft_inputs {
@@ -59,11 +65,22 @@ class work_queue {
 
     void add_to_queue(const work_item& item);
 
+    /**
+     * Processes the queued items as a dependency graph rather than in queue order. An item waits for the earlier items
+     * that write what it reads, or read or write what it writes, and otherwise runs concurrently with them on the
+     * current thread pool, e.g. the FFT of one wire alongside the IFFT of the next.
+     */
     void process_queue();
 
     std::vector<work_item> get_queue() const;
 
   private:
+    // Scalar multiplications all write this pseudo-label, so they run one at a time: each allocates a pippenger runtime
+    // state of the order of a kilobyte per point, and already uses every thread
+    static constexpr const char* PIPPENGER_STATE_LABEL = "pippenger_runtime_state";
+
+    void process_item(const work_item& item, std::mutex& mutex);
+
     proving_key* key;
     transcript::StandardTranscript* transcript;
     std::vector<work_item> work_item_queue;
@@ -11,6 +11,7 @@
 #include <memory>
 #include <mutex>
 #include <sys/stat.h>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 
@@ -26,6 +27,7 @@ template <typename Fr> std::shared_ptr<Fr[]> _allocate_aligned_memory(const size
 template <typename Fr> void Polynomial<Fr>::allocate_backing_memory(size_t n_elements)
 {
     size_ = n_elements;
+    make_fully_active();
     // capacity() is size_ plus padding for shifted polynomials
     backing_memory_ = _allocate_aligned_memory<Fr>(capacity());
     coefficients_ = backing_memory_.get();
@@ -60,6 +62,25 @@ template <typename Fr> Polynomial<Fr>::Polynomial(size_t initial_size, DontZeroM
     allocate_backing_memory(initial_size);
 }
 
+/**
+ * @brief Initialize a zero Polynomial to size 'initial_size', whose coefficients may only be made non-zero in the
+ * active range [start_index, end_index). Only the pages of memory written to are committed.
+ *
+ * @param initial_size The initial size of the polynomial.
+ * @param start_index The start of the active range.
+ * @param end_index The end of the active range.
+ */
+template <typename Fr> Polynomial<Fr>::Polynomial(size_t initial_size, size_t start_index, size_t end_index)
+{
+    ASSERT(start_index <= end_index && end_index <= initial_size);
+    size_ = initial_size;
+    start_index_ = start_index;
+    end_index_ = end_index;
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    backing_memory_ = std::static_pointer_cast<Fr[]>(get_zeroed_mem_pages(sizeof(Fr) * capacity()));
+    coefficients_ = backing_memory_.get();
+}
+
 template <typename Fr>
 Polynomial<Fr>::Polynomial(const Polynomial<Fr>& other)
     : Polynomial<Fr>(other, other.size())
@@ -68,6 +89,14 @@ Polynomial<Fr>::Polynomial(const Polynomial<Fr>& other)
 // fully copying "expensive" constructor
 template <typename Fr> Polynomial<Fr>::Polynomial(const Polynomial<Fr>& other, const size_t target_size)
 {
+    if (other.start_index_ > 0 || other.end_index_ < other.size_) {
+        // keep the copy of a polynomial with an active range as sparse as the original
+        *this = Polynomial(std::max(target_size, other.size()), other.start_index_, other.end_index_);
+        memcpy(static_cast<void*>(coefficients_ + start_index_),
+               static_cast<void*>(other.coefficients_ + start_index_),
+               sizeof(Fr) * (end_index_ - start_index_));
+        return;
+    }
     allocate_backing_memory(std::max(target_size, other.size()));
 
     memcpy(static_cast<void*>(coefficients_), static_cast<void*>(other.coefficients_), sizeof(Fr) * other.size_);
@@ -80,6 +109,8 @@ Polynomial<Fr>::Polynomial(Polynomial<Fr>&& other) noexcept
     : backing_memory_(std::exchange(other.backing_memory_, nullptr))
     , coefficients_(std::exchange(other.coefficients_, nullptr))
     , size_(std::exchange(other.size_, 0))
+    , start_index_(std::exchange(other.start_index_, 0))
+    , end_index_(std::exchange(other.end_index_, 0))
 {}
 
 // span constructor
@@ -111,6 +142,10 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator=(const Polynomia
     if (this == &other) {
         return *this;
     }
+    if (other.start_index_ > 0 || other.end_index_ < other.size_) {
+        *this = Polynomial(other);
+        return *this;
+    }
     allocate_backing_memory(other.size_);
     memcpy(static_cast<void*>(coefficients_), static_cast<void*>(other.coefficients_), sizeof(Fr) * other.size_);
     zero_memory_beyond(size_);
@@ -135,6 +170,8 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator=(Polynomial&& ot
     backing_memory_ = std::exchange(other.backing_memory_, nullptr);
     coefficients_ = std::exchange(other.coefficients_, nullptr);
     size_ = std::exchange(other.size_, 0);
+    start_index_ = std::exchange(other.start_index_, 0);
+    end_index_ = std::exchange(other.end_index_, 0);
     return *this;
 }
 
@@ -144,6 +181,8 @@ template <typename Fr> Polynomial<Fr> Polynomial<Fr>::share() const
     p.backing_memory_ = backing_memory_;
     p.size_ = size_;
     p.coefficients_ = coefficients_;
+    p.start_index_ = start_index_;
+    p.end_index_ = end_index_;
     return p;
 }
 
@@ -208,6 +247,7 @@ void Polynomial<Fr>::fft(const EvaluationDomain<Fr>& domain)
 {
     ASSERT(in_place_operation_viable(domain.size));
     zero_memory_beyond(domain.size);
+    make_fully_active();
 
     polynomial_arithmetic::fft(coefficients_, domain);
 }
@@ -218,6 +258,7 @@ void Polynomial<Fr>::partial_fft(const EvaluationDomain<Fr>& domain, Fr constant
 {
     ASSERT(in_place_operation_viable(domain.size));
     zero_memory_beyond(domain.size);
+    make_fully_active();
 
     polynomial_arithmetic::partial_fft(coefficients_, domain, constant, is_coset);
 }
@@ -228,6 +269,7 @@ void Polynomial<Fr>::coset_fft(const EvaluationDomain<Fr>& domain)
 {
     ASSERT(in_place_operation_viable(domain.size));
     zero_memory_beyond(domain.size);
+    make_fully_active();
 
     polynomial_arithmetic::coset_fft(coefficients_, domain);
 }
@@ -242,6 +284,7 @@ void Polynomial<Fr>::coset_fft(const EvaluationDomain<Fr>& domain,
 
     ASSERT(in_place_operation_viable(extended_size));
     zero_memory_beyond(extended_size);
+    make_fully_active();
 
     polynomial_arithmetic::coset_fft(coefficients_, domain, large_domain, domain_extension);
 }
@@ -252,6 +295,7 @@ void Polynomial<Fr>::coset_fft_with_constant(const EvaluationDomain<Fr>& domain,
 {
     ASSERT(in_place_operation_viable(domain.size));
     zero_memory_beyond(domain.size);
+    make_fully_active();
 
     polynomial_arithmetic::coset_fft_with_constant(coefficients_, domain, constant);
 }
@@ -262,6 +306,7 @@ void Polynomial<Fr>::coset_fft_with_generator_shift(const EvaluationDomain<Fr>&
 {
     ASSERT(in_place_operation_viable(domain.size));
     zero_memory_beyond(domain.size);
+    make_fully_active();
 
     polynomial_arithmetic::coset_fft_with_generator_shift(coefficients_, domain, constant);
 }
@@ -272,6 +317,7 @@ void Polynomial<Fr>::ifft(const EvaluationDomain<Fr>& domain)
 {
     ASSERT(in_place_operation_viable(domain.size));
     zero_memory_beyond(domain.size);
+    make_fully_active();
 
     polynomial_arithmetic::ifft(coefficients_, domain);
 }
@@ -282,6 +328,7 @@ void Polynomial<Fr>::ifft_with_constant(const EvaluationDomain<Fr>& domain, cons
 {
     ASSERT(in_place_operation_viable(domain.size));
     zero_memory_beyond(domain.size);
+    make_fully_active();
 
     polynomial_arithmetic::ifft_with_constant(coefficients_, domain, constant);
 }
@@ -292,6 +339,7 @@ void Polynomial<Fr>::coset_ifft(const EvaluationDomain<Fr>& domain)
 {
     ASSERT(in_place_operation_viable(domain.size));
     zero_memory_beyond(domain.size);
+    make_fully_active();
 
     polynomial_arithmetic::coset_ifft(coefficients_, domain);
 }
@@ -300,6 +348,7 @@ template <typename Fr>
 Fr Polynomial<Fr>::compute_kate_opening_coefficients(const Fr& z)
     requires polynomial_arithmetic::SupportsFFT<Fr>
 {
+    make_fully_active();
     return polynomial_arithmetic::compute_kate_opening_coefficients(coefficients_, coefficients_, z, size_);
 }
 
@@ -329,6 +378,9 @@ template <typename Fr> Polynomial<Fr> Polynomial<Fr>::shifted() const
     p.backing_memory_ = backing_memory_;
     p.size_ = size_;
     p.coefficients_ = coefficients_ + 1;
+    // the zero at coefficients_[0] is dropped, and the zero at coefficients_[size_] moves into view
+    p.start_index_ = start_index_ > 0 ? start_index_ - 1 : 0;
+    p.end_index_ = end_index_ > 0 ? end_index_ - 1 : 0;
     return p;
 }
 
@@ -368,6 +420,7 @@ template <typename Fr> void Polynomial<Fr>::add_scaled(std::span<const Fr> other
 {
     const size_t other_size = other.size();
     ASSERT(in_place_operation_viable(other_size));
+    make_fully_active();
 
     // Calculates number of threads with thread_utils::calculate_num_threads
     size_t num_threads = thread_utils::calculate_num_threads(other_size);
@@ -386,6 +439,7 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator+=(std::span<cons
 {
     const size_t other_size = other.size();
     ASSERT(in_place_operation_viable(other_size));
+    make_fully_active();
 
     size_t num_threads = thread_utils::calculate_num_threads(other_size);
     size_t range_per_thread = other_size / num_threads;
@@ -405,6 +459,7 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator-=(std::span<cons
 {
     const size_t other_size = other.size();
     ASSERT(in_place_operation_viable(other_size));
+    make_fully_active();
 
     size_t num_threads = thread_utils::calculate_num_threads(other_size);
     size_t range_per_thread = other_size / num_threads;
@@ -424,11 +479,13 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator*=(const Fr scali
 {
     ASSERT(in_place_operation_viable());
 
-    size_t num_threads = thread_utils::calculate_num_threads(size_);
-    size_t range_per_thread = size_ / num_threads;
-    size_t leftovers = size_ - (range_per_thread * num_threads);
+    // only the active range can be non-zero
+    const size_t active_size = end_index_ - start_index_;
+    size_t num_threads = thread_utils::calculate_num_threads(active_size);
+    size_t range_per_thread = active_size / num_threads;
+    size_t leftovers = active_size - (range_per_thread * num_threads);
     parallel_for(num_threads, [&](size_t j) {
-        size_t offset = j * range_per_thread;
+        size_t offset = start_index_ + j * range_per_thread;
         size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
         for (size_t i = offset; i < end; ++i) {
             coefficients_[i] *= scaling_factor;
@@ -445,6 +502,20 @@ template <typename Fr> Fr Polynomial<Fr>::evaluate_mle(std::span<const Fr> evalu
     // To simplify handling of edge cases, we assume that size_ is always a power of 2
     ASSERT(size_ == static_cast<size_t>(1 << m));
 
+    Fr* prev = coefficients_;
+    // the range of prev that can be non-zero
+    size_t range_start = start_index_;
+    size_t range_end = end_index_;
+    if (shift) {
+        ASSERT(prev[0] == Fr::zero());
+        prev++;
+        range_start = range_start > 0 ? range_start - 1 : 0;
+        range_end = range_end > 0 ? range_end - 1 : 0;
+    }
+    if (range_start == range_end) {
+        return Fr::zero();
+    }
+
     // we do m rounds l = 0,...,m-1.
     // in round l, n_l is the size of the buffer containing the polynomial partially evaluated
     // at u₀,..., u_l.
@@ -456,22 +527,27 @@ template <typename Fr> Fr Polynomial<Fr>::evaluate_mle(std::span<const Fr> evalu
     pointer tmp_ptr = _allocate_aligned_memory<Fr>(sizeof(Fr) * n_l);
     auto tmp = tmp_ptr.get();
 
-    Fr* prev = coefficients_;
-    if (shift) {
-        ASSERT(prev[0] == Fr::zero());
-        prev++;
-    }
-
+    // Each round only computes the entries that pairs from the previous active range fold into. Outside of the
+    // polynomial's active range it reads zeros; in tmp, the neighbours of the range that it reads are zeroed first.
     Fr u_l = evaluation_points[0];
-    for (size_t i = 0; i < n_l; ++i) {
+    size_t start_l = range_start >> 1;
+    size_t end_l = (range_end + 1) >> 1;
+    for (size_t i = start_l; i < end_l; ++i) {
         // curr[i] = (Fr(1) - u_l) * prev[i << 1] + u_l * prev[(i << 1) + 1];
         tmp[i] = prev[i << 1] + u_l * (prev[(i << 1) + 1] - prev[i << 1]);
     }
     // partially evaluate the m-1 remaining points
     for (size_t l = 1; l < m; ++l) {
-        n_l = 1 << (m - l - 1);
+        if ((start_l & 1) != 0) {
+            tmp[start_l - 1] = Fr::zero();
+        }
+        if ((end_l & 1) != 0) {
+            tmp[end_l] = Fr::zero();
+        }
+        start_l >>= 1;
+        end_l = (end_l + 1) >> 1;
         u_l = evaluation_points[l];
-        for (size_t i = 0; i < n_l; ++i) {
+        for (size_t i = start_l; i < end_l; ++i) {
             tmp[i] = tmp[i << 1] + u_l * (tmp[(i << 1) + 1] - tmp[i << 1]);
         }
     }
@@ -493,21 +569,42 @@ template <typename Fr> Polynomial<Fr> Polynomial<Fr>::partial_evaluate_mle(std::
     // evaluated at u_{m-l-1}, ..., u_{m-1} in variables X_{n-l-1}, ..., X_{n-1}. The size of this polynomial is n_l.
     size_t n_l = 1 << (n - 1);
 
+    // Folding the halves of a vector of size 2 * n_l together, the range of results that the active range [start, end)
+    // of the vector contributes to. If the active range straddles the middle, that is all of them.
+    auto fold_range = [](size_t start, size_t end, size_t n_l) -> std::pair<size_t, size_t> {
+        if (start == end) {
+            return { 0, 0 };
+        }
+        if (end <= n_l) {
+            return { start, end };
+        }
+        if (start >= n_l) {
+            return { start - n_l, end - n_l };
+        }
+        return { 0, n_l };
+    };
+
     // Temporary buffer of half the size of the polynomial
     Polynomial<Fr> intermediate(n_l, DontZeroMemory::FLAG);
 
     // Evaluate variable X_{n-1} at u_{m-1}
     Fr u_l = evaluation_points[m - 1];
 
-    for (size_t i = 0; i < n_l; i++) {
+    auto [range_start, range_end] = fold_range(start_index_, end_index_, n_l);
+    for (size_t i = range_start; i < range_end; i++) {
         // Initiate our intermediate results using this polynomial.
         intermediate[i] = at(i) + u_l * (at(i + n_l) - at(i));
     }
+    // Beyond the polynomial's active range the results are zero, which lets the later rounds skip them as well
+    std::fill(intermediate.begin(), intermediate.begin() + static_cast<std::ptrdiff_t>(range_start), Fr::zero());
+    std::fill(intermediate.begin() + static_cast<std::ptrdiff_t>(range_end), intermediate.end(), Fr::zero());
+
     // Evaluate m-1 variables X_{n-l-1}, ..., X_{n-2} at m-1 remaining values u_0,...,u_{m-2})
     for (size_t l = 1; l < m; ++l) {
         n_l = 1 << (n - l - 1);
         u_l = evaluation_points[m - l - 1];
-        for (size_t i = 0; i < n_l; ++i) {
+        std::tie(range_start, range_end) = fold_range(range_start, range_end, n_l);
+        for (size_t i = range_start; i < range_end; ++i) {
             intermediate[i] += u_l * (intermediate[i + n_l] - intermediate[i]);
         }
     }
@@ -517,6 +614,8 @@ template <typename Fr> Polynomial<Fr> Polynomial<Fr>::partial_evaluate_mle(std::
     for (size_t idx = 0; idx < n_l; ++idx) {
         result[idx] = intermediate[idx];
     }
+    result.start_index_ = range_start;
+    result.end_index_ = range_end;
 
     return result;
 }
@@ -27,6 +27,17 @@ template <typename Fr> class Polynomial {
     Polynomial(size_t initial_size);
     // Constructor that does not initialize values, use with caution to save time.
     Polynomial(size_t initial_size, DontZeroMemory flag);
+    /**
+     * @brief A zero polynomial of size 'initial_size' whose coefficients may only be made non-zero in the active range
+     * [start_index, end_index).
+     *
+     * @details The memory is zeroed pages that are only committed once written to, so a polynomial that is non-zero on
+     * a few rows costs memory in proportion to those rows rather than to its size. Consumers that know the active range
+     * (commitments, sumcheck's folding, the MLE evaluations) skip the zeros outside of it; others just read zeros.
+     * Writing outside the active range through operator[] breaks this contract, whereas the in-place operations that
+     * can (adding a polynomial, the FFTs) make the whole polynomial active.
+     */
+    Polynomial(size_t initial_size, size_t start_index, size_t end_index);
     Polynomial(const Polynomial& other);
     Polynomial(const Polynomial& other, size_t target_size);
 
@@ -66,6 +77,8 @@ template <typename Fr> class Polynomial {
         // backing_memory_.reset();
         coefficients_ = nullptr;
         size_ = 0;
+        start_index_ = 0;
+        end_index_ = 0;
     }
 
     bool operator==(Polynomial const& rhs) const;
@@ -211,8 +224,16 @@ template <typename Fr> class Polynomial {
      *
      * @param roots list of roots (r₁,…,rₘ)
      */
-    void factor_roots(std::span<const Fr> roots) { polynomial_arithmetic::factor_roots(std::span{ *this }, roots); };
-    void factor_roots(const Fr& root) { polynomial_arithmetic::factor_roots(std::span{ *this }, root); };
+    void factor_roots(std::span<const Fr> roots)
+    {
+        make_fully_active();
+        polynomial_arithmetic::factor_roots(std::span{ *this }, roots);
+    };
+    void factor_roots(const Fr& root)
+    {
+        make_fully_active();
+        polynomial_arithmetic::factor_roots(std::span{ *this }, root);
+    };
 
     iterator begin() { return coefficients_; }
     iterator end() { return coefficients_ + size_; }
@@ -231,11 +252,23 @@ template <typename Fr> class Polynomial {
     std::size_t size() const { return size_; }
     std::size_t capacity() const { return size_ + MAXIMUM_COEFFICIENT_SHIFT; }
 
+    // The coefficients outside of [start_index(), end_index()) are zero. Unless the polynomial was constructed with an
+    // active range, or derived from one that was, this is all of [0, size()).
+    std::size_t start_index() const { return start_index_; }
+    std::size_t end_index() const { return end_index_; }
+
   private:
     // allocate a fresh memory pointer for backing memory
     // DOES NOT initialize memory
     void allocate_backing_memory(size_t n_elements);
 
+    // for the in place operations that may write outside of the active range
+    void make_fully_active()
+    {
+        start_index_ = 0;
+        end_index_ = size_;
+    }
+
     // safety check for in place operations
     bool in_place_operation_viable(size_t domain_size = 0) { return (size() >= domain_size); }
 
@@ -254,6 +287,9 @@ template <typename Fr> class Polynomial {
     // 'capacity' of the array. It is not explicitly tied to the degree and is not changed by any operations on the
     // polynomial.
     size_t size_ = 0;
+    // The range [start_index_, end_index_) of coefficients that may be non-zero, see start_index()
+    size_t start_index_ = 0;
+    size_t end_index_ = 0;
 };
 
 template <typename Fr> inline std::ostream& operator<<(std::ostream& os, Polynomial<Fr> const& p)
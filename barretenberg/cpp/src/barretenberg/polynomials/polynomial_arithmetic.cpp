@@ -8,11 +8,17 @@
 #include <math.h>
 #include <memory.h>
 #include <memory>
+#include <mutex>
 
 namespace barretenberg::polynomial_arithmetic {
 
 namespace {
 
+// The largest block the FFT works on in cache, 128KiB of bn254 field elements (with as much again of roots of unity)
+constexpr size_t FFT_BLOCK_SIZE = 1UL << 12;
+// The butterflies of a round the batched FFT does for each polynomial in turn, while their roots of unity sit in L1
+constexpr size_t FFT_BATCH_CHUNK_SIZE = 64;
+
 template <typename Fr> std::shared_ptr<Fr[]> get_scratch_space(const size_t num_elements)
 {
     // WASM needs to release slab so it can be reused elsewhere.
@@ -20,8 +26,15 @@ template <typename Fr> std::shared_ptr<Fr[]> get_scratch_space(const size_t num_
 #ifdef __wasm__
     return std::static_pointer_cast<Fr[]>(get_mem_slab(num_elements * sizeof(Fr)));
 #else
+    static std::mutex mutex;
     static std::shared_ptr<Fr[]> working_memory = nullptr;
     static size_t current_size = 0;
+    std::lock_guard lock(mutex);
+    // Another FFT running concurrently (e.g. one of the work queue's) still holds the working memory, so it can't be
+    // shared. Copies are only taken under the lock, so a use count of one means nobody else can be using it.
+    if (working_memory.use_count() > 1) {
+        return std::static_pointer_cast<Fr[]>(get_mem_slab(num_elements * sizeof(Fr)));
+    }
     if (num_elements > current_size) {
         working_memory = std::static_pointer_cast<Fr[]>(get_mem_slab(num_elements * sizeof(Fr)));
         current_size = num_elements;
@@ -46,6 +59,239 @@ inline bool is_power_of_two(uint64_t x)
     return x && !(x & (x - 1));
 }
 
+// The radix-2 rounds of an FFT whose butterflies stay within a block of block_size elements, from the round of m = 2
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_block_rounds(Fr* block, const size_t block_size, const std::vector<Fr*>& root_table)
+{
+    Fr temp;
+    for (size_t m = 2; m < block_size; m <<= 1) {
+        const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
+        for (size_t k = 0; k < block_size; k += 2 * m) {
+            for (size_t j = 0; j < m; ++j) {
+                temp = round_roots[j] * block[k + j + m];
+                block[k + j + m] = block[k + j] - temp;
+                block[k + j] += temp;
+            }
+        }
+    }
+}
+
+// A butterfly of the round of m on (x0, x1) = (work[k], work[k + m]). It reads before it writes: write may alias work
+template <typename Fr, typename Output>
+inline void radix_2_butterfly(const Fr* work, const Output& write, const size_t k, const size_t m, const Fr& root)
+{
+    const Fr temp = root * work[k + m];
+    write(k + m) = work[k] - temp;
+    write(k) = work[k] + temp;
+}
+
+// The rounds of m and 2m at once on (x0, x1, x2, x3) = (work[k], work[k + m], work[k + 2m], work[k + 3m]): a round of m
+// on (x0, x1) and (x2, x3), then of 2m on (x0, x2) and (x1, x3). It reads before it writes, so write may alias work
+template <typename Fr, typename Output>
+inline void radix_4_butterfly(const Fr* work,
+                              const Output& write,
+                              const size_t k,
+                              const size_t m,
+                              const Fr& root_1,
+                              const Fr& root_2,
+                              const Fr& root_3)
+{
+    Fr temp_1 = root_1 * work[k + m];
+    Fr temp_2 = root_1 * work[k + 3 * m];
+    const Fr a_1 = work[k] - temp_1;
+    const Fr a_0 = work[k] + temp_1;
+    const Fr b_1 = work[k + 2 * m] - temp_2;
+    const Fr b_0 = work[k + 2 * m] + temp_2;
+    temp_1 = root_2 * b_0;
+    temp_2 = root_3 * b_1;
+    write(k + 2 * m) = a_0 - temp_1;
+    write(k) = a_0 + temp_1;
+    write(k + 3 * m) = a_1 - temp_2;
+    write(k + m) = a_1 + temp_2;
+}
+
+/**
+ * @brief The FFT engine behind fft_inner_parallel: the radix-2 decimation-in-time butterflies of
+ * fft_inner_parallel_radix_2, reordered so that large domains are not streamed through memory once per round.
+ *
+ * @details Each round of a radix-2 FFT reads and writes the whole domain, so beyond the cache sizes the FFT is bound by
+ * memory bandwidth rather than by field multiplications. Here:
+ *  1. The domain is cut into blocks of at most FFT_BLOCK_SIZE elements. The rounds whose butterflies stay within a
+ *     block are done a block at a time, while it sits in L2, and the bit-reversal permutation is fused into loading a
+ *     block. This is a sub-FFT over the block, and replaces the first log2(block size) passes over memory with one.
+ *  2. The rounds that remain span blocks. They are done two at a time as radix-4 butterflies, halving their passes over
+ *     memory, with a radix-2 round at the end if their number is odd. The last pass writes to the output.
+ * The butterflies, and so the lazily reduced intermediate values, are exactly those of the radix-2 kernel. A radix-4
+ * butterfly saves no multiplications here, as the 4th root of unity is not a free multiplication in a prime field.
+ *
+ * @param work a buffer of domain.size elements to transform in, may be the output itself
+ * @param input the i'th input coefficient
+ * @param output a reference to the i'th output evaluation
+ */
+template <typename Fr, typename Input, typename Output>
+    requires SupportsFFT<Fr>
+void fft_inner_blocked(const EvaluationDomain<Fr>& domain,
+                       const std::vector<Fr*>& root_table,
+                       Fr* work,
+                       const Input& input,
+                       const Output& output)
+{
+    const size_t size = domain.size;
+    if (size == 1) {
+        output(0) = input(0);
+        return;
+    }
+    const auto log2_size = static_cast<uint32_t>(domain.log2_size);
+    // Blocks no larger than a thread's share of the domain, so that every thread gets some
+    const size_t block_size = std::max(std::min(FFT_BLOCK_SIZE, domain.thread_size), std::min(size, size_t(2)));
+    const size_t num_blocks = size / block_size;
+
+    // Stage 1: a sub-FFT over each block, from the bit-reversed input
+    parallel_for(num_blocks, [&](size_t b) {
+        Fr* block = work + b * block_size;
+        const size_t offset = b * block_size;
+        Fr temp_1;
+        Fr temp_2;
+        for (size_t i = 0; i < block_size; i += 2) {
+            Fr::__copy(input(reverse_bits(static_cast<uint32_t>(offset + i), log2_size)), temp_1);
+            Fr::__copy(input(reverse_bits(static_cast<uint32_t>(offset + i + 1), log2_size)), temp_2);
+            block[i + 1] = temp_1 - temp_2;
+            block[i] = temp_1 + temp_2;
+        }
+        fft_block_rounds(block, block_size, root_table);
+    });
+
+    if (block_size == size) {
+        if (&output(0) != work) {
+            parallel_for(domain.num_threads, [&](size_t j) {
+                for (size_t i = j * domain.thread_size; i < (j + 1) * domain.thread_size; ++i) {
+                    output(i) = work[i];
+                }
+            });
+        }
+        return;
+    }
+
+    // Stage 2: the rounds across blocks
+    for (size_t m = block_size; m < size;) {
+        const bool is_last = (4 * m == size) || (2 * m == size);
+        const auto write = [&](size_t i) -> Fr& { return is_last ? output(i) : work[i]; };
+
+        if (2 * m == size) {
+            const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
+            parallel_for(domain.num_threads, [&](size_t j) {
+                const size_t start = j * (domain.thread_size >> 1);
+                const size_t end = (j + 1) * (domain.thread_size >> 1);
+                for (size_t i = start; i < end; ++i) {
+                    const size_t k = ((i & ~(m - 1)) << 1) + (i & (m - 1));
+                    radix_2_butterfly(work, write, k, m, round_roots[i & (m - 1)]);
+                }
+            });
+            m <<= 1;
+            continue;
+        }
+
+        const Fr* roots_1 = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
+        const Fr* roots_2 = root_table[static_cast<size_t>(numeric::get_msb(m))];
+        parallel_for(domain.num_threads, [&](size_t j) {
+            const size_t start = j * (domain.thread_size >> 2);
+            const size_t end = (j + 1) * (domain.thread_size >> 2);
+            for (size_t i = start; i < end; ++i) {
+                const size_t j1 = i & (m - 1);
+                const size_t k = ((i & ~(m - 1)) << 2) + j1;
+                radix_4_butterfly(work, write, k, m, roots_1[j1], roots_2[j1], roots_2[j1 + m]);
+            }
+        });
+        m <<= 2;
+    }
+}
+
+/**
+ * @brief fft_inner_blocked over several polynomials of the same domain at once, in place, with the i'th coefficient of
+ * each polynomial first multiplied by scalars[i]
+ *
+ * @details The polynomials share everything but their coefficients, so their passes are interleaved:
+ *  - The bit-reversal permutation is done in place by swaps, with the scaling fused into it.
+ *  - The sub-FFTs over blocks are split between the threads as (polynomial, block) pairs.
+ *  - The rounds across blocks go through the domain a chunk of FFT_BATCH_CHUNK_SIZE butterflies at a time, and do each
+ *    chunk for every polynomial in turn, so that its roots of unity are loaded from memory once for all of them.
+ * The butterflies are those of fft_inner_blocked, and no scratch space is needed.
+ */
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_inner_blocked_batch(const std::vector<Fr*>& polynomials,
+                             const EvaluationDomain<Fr>& domain,
+                             const std::vector<Fr*>& root_table,
+                             const Fr* scalars)
+{
+    const size_t size = domain.size;
+    const size_t num_polys = polynomials.size();
+    if (size == 1) {
+        for (Fr* coeffs : polynomials) {
+            coeffs[0] *= scalars[0];
+        }
+        return;
+    }
+    const auto log2_size = static_cast<uint32_t>(domain.log2_size);
+    const size_t block_size = std::max(std::min(FFT_BLOCK_SIZE, domain.thread_size), size_t(2));
+    const size_t num_blocks = size / block_size;
+
+    // Each pair of coefficients is swapped by the thread that owns the lower index
+    parallel_for(num_polys * domain.num_threads, [&](size_t t) {
+        Fr* coeffs = polynomials[t / domain.num_threads];
+        const size_t j = t % domain.num_threads;
+        for (size_t i = j * domain.thread_size; i < (j + 1) * domain.thread_size; ++i) {
+            const size_t swap_index = reverse_bits(static_cast<uint32_t>(i), log2_size);
+            if (i < swap_index) {
+                const Fr temp = coeffs[i] * scalars[i];
+                coeffs[i] = coeffs[swap_index] * scalars[swap_index];
+                coeffs[swap_index] = temp;
+            } else if (i == swap_index) {
+                coeffs[i] *= scalars[i];
+            }
+        }
+    });
+
+    // Consecutive pairs share a block, so the threads working at the same time share its roots of unity in cache
+    parallel_for(num_polys * num_blocks, [&](size_t t) {
+        Fr* block = polynomials[t % num_polys] + (t / num_polys) * block_size;
+        Fr temp;
+        for (size_t i = 0; i < block_size; i += 2) {
+            Fr::__copy(block[i + 1], temp);
+            block[i + 1] = block[i] - temp;
+            block[i] += temp;
+        }
+        fft_block_rounds(block, block_size, root_table);
+    });
+
+    for (size_t m = block_size; m < size;) {
+        const bool is_radix_2 = (2 * m == size);
+        const Fr* roots_1 = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
+        const Fr* roots_2 = is_radix_2 ? nullptr : root_table[static_cast<size_t>(numeric::get_msb(m))];
+        const size_t thread_range = domain.thread_size >> (is_radix_2 ? 1 : 2);
+        parallel_for(domain.num_threads, [&](size_t j) {
+            const size_t end = (j + 1) * thread_range;
+            for (size_t chunk = j * thread_range; chunk < end; chunk += FFT_BATCH_CHUNK_SIZE) {
+                const size_t chunk_end = std::min(chunk + FFT_BATCH_CHUNK_SIZE, end);
+                for (Fr* coeffs : polynomials) {
+                    const auto write = [coeffs](size_t i) -> Fr& { return coeffs[i]; };
+                    for (size_t i = chunk; i < chunk_end; ++i) {
+                        const size_t j1 = i & (m - 1);
+                        if (is_radix_2) {
+                            radix_2_butterfly(coeffs, write, ((i & ~(m - 1)) << 1) + j1, m, roots_1[j1]);
+                        } else {
+                            const size_t k = ((i & ~(m - 1)) << 2) + j1;
+                            radix_4_butterfly(coeffs, write, k, m, roots_1[j1], roots_2[j1], roots_2[j1 + m]);
+                        }
+                    }
+                }
+            }
+        });
+        m <<= (is_radix_2 ? 1 : 2);
+    }
+}
+
 template <typename Fr>
 void copy_polynomial(const Fr* src, Fr* dest, size_t num_src_coefficients, size_t num_target_coefficients)
 {
@@ -170,10 +416,10 @@ void compute_multiplicative_subgroup(const size_t log2_subgroup_size,
 
 template <typename Fr>
     requires SupportsFFT<Fr>
-void fft_inner_parallel(std::vector<Fr*> coeffs,
-                        const EvaluationDomain<Fr>& domain,
-                        const Fr&,
-                        const std::vector<Fr*>& root_table)
+void fft_inner_parallel_radix_2(std::vector<Fr*> coeffs,
+                                const EvaluationDomain<Fr>& domain,
+                                const Fr&,
+                                const std::vector<Fr*>& root_table)
 {
     auto scratch_space_ptr = get_scratch_space<Fr>(domain.size);
     auto scratch_space = scratch_space_ptr.get();
@@ -298,97 +544,45 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
 
 template <typename Fr>
     requires SupportsFFT<Fr>
-void fft_inner_parallel(
-    Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain, const Fr&, const std::vector<Fr*>& root_table)
+void fft_inner_parallel(std::vector<Fr*> coeffs,
+                        const EvaluationDomain<Fr>& domain,
+                        const Fr&,
+                        const std::vector<Fr*>& root_table)
 {
-    parallel_for(domain.num_threads, [&](size_t j) {
-        Fr temp_1;
-        Fr temp_2;
-        for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); i += 2) {
-            uint32_t next_index_1 = (uint32_t)reverse_bits((uint32_t)i + 2, (uint32_t)domain.log2_size);
-            uint32_t next_index_2 = (uint32_t)reverse_bits((uint32_t)i + 3, (uint32_t)domain.log2_size);
-            __builtin_prefetch(&coeffs[next_index_1]);
-            __builtin_prefetch(&coeffs[next_index_2]);
+    auto scratch_space_ptr = get_scratch_space<Fr>(domain.size);
 
-            uint32_t swap_index_1 = (uint32_t)reverse_bits((uint32_t)i, (uint32_t)domain.log2_size);
-            uint32_t swap_index_2 = (uint32_t)reverse_bits((uint32_t)i + 1, (uint32_t)domain.log2_size);
+    const size_t num_polys = coeffs.size();
+    ASSERT(is_power_of_two(num_polys));
+    const size_t poly_size = domain.size / num_polys;
+    ASSERT(is_power_of_two(poly_size));
+    const size_t poly_mask = poly_size - 1;
+    const size_t log2_poly_size = (size_t)numeric::get_msb(poly_size);
 
-            Fr::__copy(coeffs[swap_index_1], temp_1);
-            Fr::__copy(coeffs[swap_index_2], temp_2);
-            target[i + 1] = temp_1 - temp_2;
-            target[i] = temp_1 + temp_2;
-        }
-    });
+    fft_inner_blocked(
+        domain,
+        root_table,
+        scratch_space_ptr.get(),
+        [&](size_t i) -> const Fr& { return coeffs[i >> log2_poly_size][i & poly_mask]; },
+        [&](size_t i) -> Fr& { return coeffs[i >> log2_poly_size][i & poly_mask]; });
+}
 
-    // hard code exception for when the domain size is tiny - we won't execute the next loop, so need to manually
-    // reduce + copy
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_inner_parallel(
+    Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain, const Fr&, const std::vector<Fr*>& root_table)
+{
+    fft_inner_blocked(
+        domain,
+        root_table,
+        target,
+        [&](size_t i) -> const Fr& { return coeffs[i]; },
+        [&](size_t i) -> Fr& { return target[i]; });
+
+    // hard code exception for when the domain size is tiny, kept from the radix-2 kernel
     if (domain.size <= 2) {
         coeffs[0] = target[0];
         coeffs[1] = target[1];
     }
-
-    // outer FFT loop
-    for (size_t m = 2; m < (domain.size); m <<= 1) {
-        parallel_for(domain.num_threads, [&](size_t j) {
-            Fr temp;
-
-            // Ok! So, what's going on here? This is the inner loop of the FFT algorithm, and we want to break it
-            // out into multiple independent threads. For `num_threads`, each thread will evaluation `domain.size /
-            // num_threads` of the polynomial. The actual iteration length will be half of this, because we leverage
-            // the fact that \omega^{n/2} = -\omega (where \omega is a root of unity)
-
-            // Here, `start` and `end` are used as our iterator limits, so that we can use our iterator `i` to
-            // directly access the roots of unity lookup table
-            const size_t start = j * (domain.thread_size >> 1);
-            const size_t end = (j + 1) * (domain.thread_size >> 1);
-
-            // For all but the last round of our FFT, the roots of unity that we need, will be a subset of our
-            // lookup table. e.g. for a size 2^n FFT, the 2^n'th roots create a multiplicative subgroup of order 2^n
-            //      the 1st round will use the roots from the multiplicative subgroup of order 2 : the 2'th roots of
-            //      unity the 2nd round will use the roots from the multiplicative subgroup of order 4 : the 4'th
-            //      roots of unity
-            // i.e. each successive FFT round will double the set of roots that we need to index.
-            // We have already laid out the `root_table` container so that each FFT round's roots are linearly
-            // ordered in memory. For all FFT rounds, the number of elements we're iterating over is greater than
-            // the size of our lookup table. We need to access this table in a cyclical fasion - i.e. for a subgroup
-            // of size x, the first x iterations will index the subgroup elements in order, then for the next x
-            // iterations, we loop back to the start.
-
-            // We could implement the algorithm by having 2 nested loops (where the inner loop iterates over the
-            // root table), but we want to flatten this out - as for the first few rounds, the inner loop will be
-            // tiny and we'll have quite a bit of unneccesary branch checks For each iteration of our flattened
-            // loop, indexed by `i`, the element of the root table we need to access will be `i % (current round
-            // subgroup size)` Given that each round subgroup size is `m`, which is a power of 2, we can index the
-            // root table with a very cheap `i & (m - 1)` Which is why we have this odd `block_mask` variable
-            const size_t block_mask = m - 1;
-
-            // The next problem to tackle, is we now need to efficiently index the polynomial element in
-            // `scratch_space` in our flattened loop If we used nested loops, the outer loop (e.g. `y`) iterates
-            // from 0 to 'domain size', in steps of 2 * m, with the inner loop (e.g. `z`) iterating from 0 to m. We
-            // have our inner loop indexer with `i & (m - 1)`. We need to add to this our outer loop indexer, which
-            // is equivalent to taking our indexer `i`, masking out the bits used in the 'inner loop', and doubling
-            // the result. i.e. polynomial indexer = (i & (m - 1)) + ((i & ~(m - 1)) >> 1) To simplify this, we
-            // cache index_mask = ~block_mask, meaning that our indexer is just `((i & index_mask) << 1 + (i &
-            // block_mask)`
-            const size_t index_mask = ~block_mask;
-
-            // `round_roots` fetches the pointer to this round's lookup table. We use `numeric::get_msb(m) - 1` as
-            // our indexer, because we don't store the precomputed root values for the 1st round (because they're
-            // all 1).
-            const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
-
-            // Finally, we want to treat the final round differently from the others,
-            // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
-            // `scratch_space`
-            for (size_t i = start; i < end; ++i) {
-                size_t k1 = (i & index_mask) << 1;
-                size_t j1 = i & block_mask;
-                temp = round_roots[j1] * target[k1 + j1 + m];
-                target[k1 + j1 + m] = target[k1 + j1] - temp;
-                target[k1 + j1] += temp;
-            }
-        });
-    }
 }
 
 template <typename Fr>
@@ -622,6 +816,30 @@ void coset_fft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain)
     fft(coeffs, domain);
 }
 
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void batch_coset_fft(const std::vector<Fr*>& polynomials, const EvaluationDomain<Fr>& domain)
+{
+    if (polynomials.size() <= 1) {
+        for (Fr* coeffs : polynomials) {
+            coset_fft(coeffs, domain);
+        }
+        return;
+    }
+    // The powers of the coset generator, computed once for all of the polynomials
+    auto powers_ptr = std::static_pointer_cast<Fr[]>(get_mem_slab(domain.size * sizeof(Fr)));
+    Fr* powers = powers_ptr.get();
+    parallel_for(domain.num_threads, [&](size_t j) {
+        const size_t start = j * domain.thread_size;
+        Fr power = domain.generator.pow(static_cast<uint64_t>(start));
+        for (size_t i = start; i < start + domain.thread_size; ++i) {
+            powers[i] = (i < domain.generator_size) ? power : Fr::one();
+            power *= domain.generator;
+        }
+    });
+    fft_inner_blocked_batch(polynomials, domain, domain.get_round_roots(), powers);
+}
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void coset_fft(Fr* coeffs,
@@ -1371,6 +1589,10 @@ template fr evaluate<fr>(const std::vector<fr*>, const fr&, const size_t);
 template void copy_polynomial<fr>(const fr*, fr*, size_t, size_t);
 template void fft_inner_serial<fr>(std::vector<fr*>, const size_t, const std::vector<fr*>&);
 template void fft_inner_parallel<fr>(std::vector<fr*>, const EvaluationDomain<fr>&, const fr&, const std::vector<fr*>&);
+template void fft_inner_parallel_radix_2<fr>(std::vector<fr*>,
+                                             const EvaluationDomain<fr>&,
+                                             const fr&,
+                                             const std::vector<fr*>&);
 template void fft<fr>(fr*, const EvaluationDomain<fr>&);
 template void fft<fr>(fr*, fr*, const EvaluationDomain<fr>&);
 template void fft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
@@ -1378,6 +1600,7 @@ template void fft_with_constant<fr>(fr*, const EvaluationDomain<fr>&, const fr&)
 template void coset_fft<fr>(fr*, const EvaluationDomain<fr>&);
 template void coset_fft<fr>(fr*, fr*, const EvaluationDomain<fr>&);
 template void coset_fft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
+template void batch_coset_fft<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
 template void coset_fft<fr>(fr*, const EvaluationDomain<fr>&, const EvaluationDomain<fr>&, const size_t);
 template void coset_fft_with_constant<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
 template void coset_fft_with_generator_shift<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
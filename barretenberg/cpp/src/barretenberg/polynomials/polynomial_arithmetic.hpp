@@ -38,6 +38,13 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
                         const EvaluationDomain<Fr>& domain,
                         const Fr&,
                         const std::vector<Fr*>& root_table);
+// The radix-2 kernel fft_inner_parallel used to be, which makes a pass over memory per round. For tests and benchmarks.
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_inner_parallel_radix_2(std::vector<Fr*> coeffs,
+                                const EvaluationDomain<Fr>& domain,
+                                const Fr&,
+                                const std::vector<Fr*>& root_table);
 
 template <typename Fr>
     requires SupportsFFT<Fr>
@@ -61,6 +68,11 @@ void coset_fft(Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain);
 template <typename Fr>
     requires SupportsFFT<Fr>
 void coset_fft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain);
+// The coset FFT of each of several polynomials of the domain, in place. Cheaper than a coset_fft of each, as the
+// polynomials share the powers of the coset generator and each load of a root of unity, and need no scratch space.
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void batch_coset_fft(const std::vector<Fr*>& polynomials, const EvaluationDomain<Fr>& domain);
 template <typename Fr>
     requires SupportsFFT<Fr>
 void coset_fft(Fr* coeffs,
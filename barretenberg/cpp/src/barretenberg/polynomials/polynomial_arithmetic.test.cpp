@@ -186,6 +186,86 @@ TEST(polynomials, split_polynomial_fft_ifft_consistency)
     }
 }
 
+// Domains from two elements up to several FFT blocks, so that the blocked kernel has both radix-4 and radix-2 rounds
+// left after its in-cache sub-FFTs
+TEST(polynomials, fft_matches_radix_2_kernel)
+{
+    for (size_t log2_n = 1; log2_n <= 15; ++log2_n) {
+        const size_t n = 1UL << log2_n;
+        auto domain = evaluation_domain(n);
+        domain.compute_lookup_table();
+
+        // Any values will do, and these are much quicker than random ones
+        polynomial input(n);
+        fr value = fr(7).pow(static_cast<uint64_t>(log2_n + 1));
+        for (auto& coeff : input) {
+            coeff = value;
+            value = value.sqr() + fr(1);
+        }
+
+        polynomial expected(input);
+        polynomial_arithmetic::fft_inner_parallel_radix_2(
+            { expected.data().get() }, domain, domain.root, domain.get_round_roots());
+
+        polynomial result(input);
+        polynomial_arithmetic::fft(result.data().get(), domain);
+        EXPECT_EQ(result, expected) << "n = " << n;
+
+        polynomial source(input);
+        polynomial target(n);
+        polynomial_arithmetic::fft(source.data().get(), target.data().get(), domain);
+        EXPECT_EQ(target, expected) << "n = " << n;
+
+        if (n >= 4) {
+            const size_t poly_size = n / 4;
+            std::vector<polynomial> parts;
+            std::vector<fr*> coeffs;
+            for (size_t j = 0; j < 4; ++j) {
+                parts.emplace_back(poly_size);
+                for (size_t i = 0; i < poly_size; ++i) {
+                    parts[j][i] = input[j * poly_size + i];
+                }
+                coeffs.push_back(parts[j].data().get());
+            }
+            polynomial_arithmetic::fft(coeffs, domain);
+            for (size_t i = 0; i < n; ++i) {
+                EXPECT_EQ(parts[i / poly_size][i % poly_size], expected[i]) << "n = " << n;
+            }
+        }
+    }
+}
+
+TEST(polynomials, batch_coset_fft_matches_coset_fft)
+{
+    for (size_t log2_n = 1; log2_n <= 14; ++log2_n) {
+        const size_t n = 1UL << log2_n;
+        auto domain = evaluation_domain(n);
+        domain.compute_lookup_table();
+
+        std::vector<polynomial> expected;
+        std::vector<polynomial> results;
+        std::vector<fr*> coeffs;
+        for (size_t j = 0; j < 3; ++j) {
+            polynomial input(n);
+            fr value = fr(7).pow(static_cast<uint64_t>(log2_n + j + 1));
+            for (auto& coeff : input) {
+                coeff = value;
+                value = value.sqr() + fr(1);
+            }
+            expected.emplace_back(input);
+            polynomial_arithmetic::coset_fft(expected[j].data().get(), domain);
+            results.emplace_back(input);
+        }
+        for (auto& result : results) {
+            coeffs.push_back(result.data().get());
+        }
+        polynomial_arithmetic::batch_coset_fft(coeffs, domain);
+        for (size_t j = 0; j < 3; ++j) {
+            EXPECT_EQ(results[j], expected[j]) << "n = " << n << ", polynomial " << j;
+        }
+    }
+}
+
 TEST(polynomials, fft_coset_ifft_consistency)
 {
     constexpr size_t n = 256;
@@ -1132,6 +1212,75 @@ TYPED_TEST(PolynomialTests, partial_evaluate_mle)
     EXPECT_EQ(v_result, v_expected);
 }
 
+TYPED_TEST(PolynomialTests, active_range)
+{
+    using FF = TypeParam;
+
+    // N = 4096 is large enough for the zeroed pages to be a mapping rather than a slab
+    auto test_case = [](size_t N, size_t start, size_t end) {
+        const size_t m = numeric::get_msb(N);
+        Polynomial<FF> poly(N, start, end);
+        EXPECT_EQ(poly.start_index(), start);
+        EXPECT_EQ(poly.end_index(), end);
+        for (size_t i = 0; i < poly.size(); ++i) {
+            EXPECT_EQ(poly[i], FF::zero());
+        }
+        for (size_t i = start; i < end; ++i) {
+            poly[i] = FF::random_element();
+        }
+        // the same coefficients, with all of them active
+        Polynomial<FF> dense(std::span<const FF>{ poly });
+        EXPECT_EQ(dense.start_index(), 0UL);
+        EXPECT_EQ(dense.end_index(), N);
+
+        // copies and shares keep the active range
+        Polynomial<FF> copy(poly);
+        EXPECT_EQ(copy, dense);
+        EXPECT_EQ(copy.start_index(), start);
+        EXPECT_EQ(copy.end_index(), end);
+        EXPECT_EQ(poly.share().start_index(), start);
+
+        std::vector<FF> u(m);
+        for (auto& u_l : u) {
+            u_l = FF::random_element();
+        }
+        EXPECT_EQ(poly.evaluate_mle(u), dense.evaluate_mle(u));
+        if (start > 0) {
+            EXPECT_EQ(poly.evaluate_mle(u, true), dense.evaluate_mle(u, true));
+            auto shifted = poly.shifted();
+            EXPECT_EQ(shifted.start_index(), start - 1);
+            EXPECT_EQ(shifted.end_index(), end - 1);
+        }
+        for (size_t k = 1; k < m; ++k) {
+            std::span<const FF> u_k{ u.begin() + static_cast<std::ptrdiff_t>(m - k), u.end() };
+            auto partial = poly.partial_evaluate_mle(u_k);
+            EXPECT_EQ(partial, dense.partial_evaluate_mle(u_k));
+            for (size_t i = 0; i < partial.size(); ++i) {
+                if (i < partial.start_index() || i >= partial.end_index()) {
+                    EXPECT_EQ(partial[i], FF::zero());
+                }
+            }
+        }
+
+        // scaling stays within the active range, adding makes the whole polynomial active
+        poly *= FF(3);
+        EXPECT_EQ(poly.start_index(), start);
+        poly += dense;
+        EXPECT_EQ(poly.start_index(), 0UL);
+        EXPECT_EQ(poly.end_index(), N);
+        dense *= FF(4);
+        EXPECT_EQ(poly, dense);
+    };
+    for (const size_t N : { size_t(32), size_t(4096) }) {
+        test_case(N, 0, 1);
+        test_case(N, N - 1, N);
+        test_case(N, 3, 7);
+        test_case(N, N / 2 - 1, N / 2 + 1);
+        test_case(N, 5, 5);
+        test_case(N, 0, N);
+    }
+}
+
 TYPED_TEST(PolynomialTests, factor_roots)
 {
     using FF = TypeParam;
@@ -210,14 +210,28 @@ void new_plonk_scalar_multiplications_bench(State& state) noexcept
 }
 BENCHMARK(new_plonk_scalar_multiplications_bench)->Unit(benchmark::kMillisecond);
 
+// Reports the FFT's throughput as the bytes of the domain it transforms per second, i.e. as if it read and wrote the
+// domain once, over wall time as the FFTs are parallel. This is what bounds large FFTs, so it is comparable to the
+// machine's memory bandwidth.
+void set_fft_bytes_processed(State& state)
+{
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * 2 * state.range(0) *
+                            static_cast<int64_t>(sizeof(fr)));
+}
+
 void coset_fft_bench_parallel(State& state) noexcept
 {
     for (auto _ : state) {
         size_t idx = (size_t)numeric::get_msb((uint64_t)state.range(0)) - (size_t)numeric::get_msb(START);
         barretenberg::polynomial_arithmetic::coset_fft(globals.data, evaluation_domains[idx]);
     }
+    set_fft_bytes_processed(state);
 }
-BENCHMARK(coset_fft_bench_parallel)->RangeMultiplier(2)->Range(START * 4, MAX_GATES * 4)->Unit(benchmark::kMicrosecond);
+BENCHMARK(coset_fft_bench_parallel)
+    ->RangeMultiplier(2)
+    ->Range(START * 4, MAX_GATES * 4)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
 
 void alternate_coset_fft_bench_parallel(State& state) noexcept
 {
@@ -226,11 +240,53 @@ void alternate_coset_fft_bench_parallel(State& state) noexcept
         barretenberg::polynomial_arithmetic::coset_fft(
             globals.data, evaluation_domains[idx - 2], evaluation_domains[idx - 2], 4);
     }
+    set_fft_bytes_processed(state);
 }
 BENCHMARK(alternate_coset_fft_bench_parallel)
     ->RangeMultiplier(2)
     ->Range(START * 4, MAX_GATES * 4)
-    ->Unit(benchmark::kMicrosecond);
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+// The coset FFTs of a batch of polynomials, as for the selectors of a proving key: one at a time, then batched
+constexpr size_t COSET_FFT_BATCH_SIZE = 4;
+
+void coset_fft_bench_batch_one_at_a_time(State& state) noexcept
+{
+    for (auto _ : state) {
+        size_t idx = (size_t)numeric::get_msb((uint64_t)state.range(0)) - (size_t)numeric::get_msb(START);
+        for (size_t i = 0; i < COSET_FFT_BATCH_SIZE; ++i) {
+            barretenberg::polynomial_arithmetic::coset_fft(globals.data + i * (size_t)state.range(0),
+                                                           evaluation_domains[idx]);
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(COSET_FFT_BATCH_SIZE) * 2 * state.range(0) *
+                            static_cast<int64_t>(sizeof(fr)));
+}
+BENCHMARK(coset_fft_bench_batch_one_at_a_time)
+    ->RangeMultiplier(4)
+    ->Range(START * 4, MAX_GATES * 4)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+void coset_fft_bench_batch(State& state) noexcept
+{
+    std::vector<fr*> polynomials;
+    for (size_t i = 0; i < COSET_FFT_BATCH_SIZE; ++i) {
+        polynomials.push_back(globals.data + i * (size_t)state.range(0));
+    }
+    for (auto _ : state) {
+        size_t idx = (size_t)numeric::get_msb((uint64_t)state.range(0)) - (size_t)numeric::get_msb(START);
+        barretenberg::polynomial_arithmetic::batch_coset_fft(polynomials, evaluation_domains[idx]);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(COSET_FFT_BATCH_SIZE) * 2 * state.range(0) *
+                            static_cast<int64_t>(sizeof(fr)));
+}
+BENCHMARK(coset_fft_bench_batch)
+    ->RangeMultiplier(4)
+    ->Range(START * 4, MAX_GATES * 4)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
 
 void fft_bench_parallel(State& state) noexcept
 {
@@ -238,8 +294,30 @@ void fft_bench_parallel(State& state) noexcept
         size_t idx = (size_t)numeric::get_msb((uint64_t)state.range(0)) - (size_t)numeric::get_msb(START);
         barretenberg::polynomial_arithmetic::fft(globals.data, evaluation_domains[idx]);
     }
+    set_fft_bytes_processed(state);
+}
+BENCHMARK(fft_bench_parallel)
+    ->RangeMultiplier(2)
+    ->Range(START * 4, MAX_GATES * 4)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+// The radix-2 kernel that makes a pass over memory per round, to compare fft_bench_parallel against
+void fft_bench_parallel_radix_2(State& state) noexcept
+{
+    for (auto _ : state) {
+        size_t idx = (size_t)numeric::get_msb((uint64_t)state.range(0)) - (size_t)numeric::get_msb(START);
+        const auto& domain = evaluation_domains[idx];
+        barretenberg::polynomial_arithmetic::fft_inner_parallel_radix_2(
+            { globals.data }, domain, domain.root, domain.get_round_roots());
+    }
+    set_fft_bytes_processed(state);
 }
-BENCHMARK(fft_bench_parallel)->RangeMultiplier(2)->Range(START * 4, MAX_GATES * 4)->Unit(benchmark::kMicrosecond);
+BENCHMARK(fft_bench_parallel_radix_2)
+    ->RangeMultiplier(2)
+    ->Range(START * 4, MAX_GATES * 4)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
 
 void fft_bench_serial(State& state) noexcept
 {
@@ -31,7 +31,8 @@ void construct_selector_polynomials(const typename Flavor::CircuitBuilder& circu
         gate_offset += num_ecc_op_gates;
         const size_t op_gate_offset = zero_row_offset;
         // The op gate selector is simply the indicator on the domain [offset, num_ecc_op_gates + offset - 1]
-        barretenberg::polynomial ecc_op_selector(proving_key->circuit_size);
+        barretenberg::polynomial ecc_op_selector(
+            proving_key->circuit_size, op_gate_offset, op_gate_offset + num_ecc_op_gates);
         for (size_t i = 0; i < num_ecc_op_gates; ++i) {
             ecc_op_selector[i + op_gate_offset] = 1;
         }
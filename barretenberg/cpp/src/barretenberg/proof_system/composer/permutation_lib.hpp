@@ -15,6 +15,7 @@
 #include "barretenberg/polynomials/polynomial.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <initializer_list>
@@ -425,23 +426,30 @@ void compute_plonk_permutation_lagrange_polynomials_from_mapping(
 template <size_t program_width>
 void compute_monomial_and_coset_fft_polynomials_from_lagrange(std::string label, plonk::proving_key* key)
 {
+    std::array<barretenberg::polynomial, program_width> sigma_polynomials;
+    std::array<barretenberg::polynomial, program_width> sigma_ffts;
+    std::vector<barretenberg::fr*> coset_fft_coefficients;
     for (size_t i = 0; i < program_width; ++i) {
-        std::string index = std::to_string(i + 1);
-        std::string prefix = label + "_" + index;
+        std::string prefix = label + "_" + std::to_string(i + 1);
 
         // Construct permutation polynomials in lagrange base
         auto sigma_polynomial_lagrange = key->polynomial_store.get(prefix + "_lagrange");
         // Compute permutation polynomial monomial form
-        barretenberg::polynomial sigma_polynomial(key->circuit_size);
+        sigma_polynomials[i] = barretenberg::polynomial(key->circuit_size);
         barretenberg::polynomial_arithmetic::ifft(
-            (barretenberg::fr*)&sigma_polynomial_lagrange[0], &sigma_polynomial[0], key->small_domain);
+            (barretenberg::fr*)&sigma_polynomial_lagrange[0], &sigma_polynomials[i][0], key->small_domain);
+
+        sigma_ffts[i] = barretenberg::polynomial(sigma_polynomials[i], key->large_domain.size);
+        coset_fft_coefficients.push_back(&sigma_ffts[i][0]);
+    }
 
-        // Compute permutation polynomial coset FFT form
-        barretenberg::polynomial sigma_fft(sigma_polynomial, key->large_domain.size);
-        sigma_fft.coset_fft(key->large_domain);
+    // Compute the permutation polynomials' coset FFT forms together, as they share a domain
+    barretenberg::polynomial_arithmetic::batch_coset_fft(coset_fft_coefficients, key->large_domain);
 
-        key->polynomial_store.put(prefix, sigma_polynomial.share());
-        key->polynomial_store.put(prefix + "_fft", sigma_fft.share());
+    for (size_t i = 0; i < program_width; ++i) {
+        std::string prefix = label + "_" + std::to_string(i + 1);
+        key->polynomial_store.put(prefix, sigma_polynomials[i].share());
+        key->polynomial_store.put(prefix + "_fft", sigma_ffts[i].share());
     }
 }
 
@@ -473,8 +481,9 @@ void compute_standard_plonk_sigma_permutations(const typename Flavor::CircuitBui
 template <typename Flavor> inline void compute_first_and_last_lagrange_polynomials(const auto& proving_key)
 {
     const size_t n = proving_key->circuit_size;
-    typename Flavor::Polynomial lagrange_polynomial_0(n);
-    typename Flavor::Polynomial lagrange_polynomial_n_min_1(n);
+    // each is non-zero at a single row, so only that row is active
+    typename Flavor::Polynomial lagrange_polynomial_0(n, 0, 1);
+    typename Flavor::Polynomial lagrange_polynomial_n_min_1(n, n - 1, n);
     lagrange_polynomial_0[0] = 1;
     proving_key->lagrange_first = lagrange_polynomial_0.share();
 
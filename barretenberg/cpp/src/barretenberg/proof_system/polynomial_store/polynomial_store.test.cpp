@@ -1,8 +1,12 @@
 #include <cstddef>
+#include <filesystem>
 #include <gtest/gtest.h>
+#include <unistd.h>
 
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "polynomial_store.hpp"
+#include "polynomial_store_cache.hpp"
+#include "polynomial_store_file.hpp"
 
 namespace proof_system {
 
@@ -90,4 +94,90 @@ TEST(PolynomialStore, Remove)
     EXPECT_EQ(polynomial_store.get_size_in_bytes(), bytes_expected);
 }
 
+#ifndef __wasm__
+namespace {
+Polynomial random_polynomial(size_t size)
+{
+    Polynomial poly(size);
+    for (auto& coeff : poly) {
+        coeff = Fr::random_element();
+    }
+    return poly;
+}
+} // namespace
+
+// Polynomials read back from their files, whether or not the writer got to them, and after being overwritten
+TEST(PolynomialStoreFile, PutThenGet)
+{
+    // A small limit on pending bytes, so that puts also wait for the writer
+    PolynomialStoreFile<Fr> polynomial_store(std::filesystem::temp_directory_path().string(), 4096 * sizeof(Fr));
+    std::vector<Polynomial> expected;
+    for (size_t i = 0; i < 8; ++i) {
+        expected.emplace_back(random_polynomial(1024 << (i % 3)));
+        polynomial_store.put("id_" + std::to_string(i), Polynomial(expected.back()));
+        EXPECT_EQ(polynomial_store.get("id_" + std::to_string(i)), expected.back());
+    }
+    polynomial_store.put("empty", Polynomial());
+    expected[3] = random_polynomial(100);
+    polynomial_store.put("id_3", Polynomial(expected[3]));
+
+    polynomial_store.flush();
+    EXPECT_EQ(polynomial_store.get_pending_bytes(), 0U);
+    for (size_t i = 0; i < 8; ++i) {
+        polynomial_store.prefetch("id_" + std::to_string(i));
+        EXPECT_EQ(polynomial_store.get("id_" + std::to_string(i)), expected[i]);
+    }
+    EXPECT_TRUE(polynomial_store.get("empty").is_empty());
+    EXPECT_THROW(polynomial_store.get("id_8"), std::out_of_range);
+}
+
+// A failed write is reported once and keeps its polynomial in memory, later writes are unaffected
+TEST(PolynomialStoreFile, RecoversFromWriteFailure)
+{
+    const auto directory = std::filesystem::temp_directory_path() / ("bb_polynomial_store_" + std::to_string(getpid()));
+    std::filesystem::remove_all(directory);
+    PolynomialStoreFile<Fr> polynomial_store(directory.string());
+
+    const Polynomial unwritten = random_polynomial(64);
+    // Depending on the timing of the writer, the failure is reported by the put or by the flush, but only once
+    EXPECT_THROW(
+        {
+            polynomial_store.put("unwritten", Polynomial(unwritten));
+            polynomial_store.flush();
+        },
+        std::runtime_error);
+    EXPECT_NO_THROW(polynomial_store.flush());
+    EXPECT_EQ(polynomial_store.get_pending_bytes(), 0U);
+    EXPECT_EQ(polynomial_store.get("unwritten"), unwritten);
+
+    std::filesystem::create_directory(directory);
+    const Polynomial written = random_polynomial(64);
+    polynomial_store.put("written", Polynomial(written));
+    EXPECT_NO_THROW(polynomial_store.flush());
+    EXPECT_EQ(polynomial_store.get("written"), written);
+    EXPECT_EQ(polynomial_store.get("unwritten"), unwritten);
+    std::filesystem::remove_all(directory);
+}
+
+// The cache spills its smallest polynomials to the file store, and copies of it see them too
+TEST(PolynomialStoreCache, SpillsToFiles)
+{
+    PolynomialStoreCache polynomial_store(2);
+    std::vector<Polynomial> expected;
+    for (size_t i = 0; i < 6; ++i) {
+        expected.emplace_back(random_polynomial(64 * (i + 1)));
+        polynomial_store.put("id_" + std::to_string(i), Polynomial(expected.back()));
+    }
+    PolynomialStoreCache copy(polynomial_store);
+    for (size_t i = 0; i < 6; ++i) {
+        EXPECT_EQ(polynomial_store.get("id_" + std::to_string(i)), expected[i]);
+        EXPECT_EQ(copy.get("id_" + std::to_string(i)), expected[i]);
+    }
+    // The copy's cache is its own
+    copy.put("id_6", random_polynomial(10));
+    copy.put("id_7", random_polynomial(10));
+    EXPECT_EQ(copy.get("id_5"), expected[5]);
+}
+#endif
+
 } // namespace proof_system
@@ -10,6 +10,42 @@ PolynomialStoreCache::PolynomialStoreCache(size_t max_cache_size)
     : max_cache_size_(max_cache_size)
 {}
 
+// size_map_ points into cache_, so a copy has to point into its own cache_
+PolynomialStoreCache::PolynomialStoreCache(PolynomialStoreCache const& other)
+    : cache_(other.cache_)
+    , external_store(other.external_store)
+#ifndef __wasm__
+    , next_spilled_(other.next_spilled_)
+    , last_spilled_(other.last_spilled_)
+#endif
+    , max_cache_size_(other.max_cache_size_)
+{
+    rebuild_size_map();
+}
+
+PolynomialStoreCache& PolynomialStoreCache::operator=(PolynomialStoreCache const& other)
+{
+    if (this != &other) {
+        cache_ = other.cache_;
+        external_store = other.external_store;
+#ifndef __wasm__
+        next_spilled_ = other.next_spilled_;
+        last_spilled_ = other.last_spilled_;
+#endif
+        max_cache_size_ = other.max_cache_size_;
+        rebuild_size_map();
+    }
+    return *this;
+}
+
+void PolynomialStoreCache::rebuild_size_map()
+{
+    size_map_.clear();
+    for (auto it = cache_.begin(); it != cache_.end(); ++it) {
+        size_map_.insert({ it->second.size(), it });
+    }
+}
+
 void PolynomialStoreCache::put(std::string const& key, Polynomial&& value)
 {
     // info("cache put ", key);
@@ -35,6 +71,13 @@ PolynomialStoreCache::Polynomial PolynomialStoreCache::get(std::string const& ke
     }
 
     // info("cache get miss ", key);
+#ifndef __wasm__
+    // Start reading the next polynomial in spill order while this one is copied in
+    auto next = next_spilled_.find(key);
+    if (next != next_spilled_.end() && !cache_.contains(next->second)) {
+        external_store.prefetch(next->second);
+    }
+#endif
     return external_store.get(key);
 };
 
@@ -48,6 +91,12 @@ void PolynomialStoreCache::purge_until_free()
         size_map_.erase(size_it);
         cache_.erase(cache_it);
         // info("cache purging ", key, " size ", size);
+#ifndef __wasm__
+        if (!last_spilled_.empty() && last_spilled_ != key) {
+            next_spilled_[last_spilled_] = key;
+        }
+        last_spilled_ = key;
+#endif
         external_store.put(key, std::move(p));
     }
 }
@@ -1,4 +1,5 @@
 #pragma once
+#include "./polynomial_store_file.hpp"
 #include "./polynomial_store_wasm.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include <map>
@@ -14,18 +15,34 @@ namespace proof_system {
  * In combination with the slab allocator, this brings us to about 4GB mem usage for 512k circuits.
  * In tests using just the external store increased proof time from by about 50%.
  * This pretty much recoups all losses.
+ * The external store is the host's data store in WASM builds, and temporary files (PolynomialStoreFile) in native
+ * builds. Spilled polynomials tend to be read back in the order they were spilled, so in native builds a miss also
+ * prefetches the file of the polynomial spilled after the one requested.
  */
 class PolynomialStoreCache {
   private:
     using Polynomial = barretenberg::Polynomial<barretenberg::fr>;
     std::map<std::string, Polynomial> cache_;
     std::multimap<size_t, std::map<std::string, Polynomial>::iterator> size_map_;
+#ifdef __wasm__
     PolynomialStoreWasm<barretenberg::fr> external_store;
+#else
+    PolynomialStoreFile<barretenberg::fr> external_store;
+    // The key spilled after each spilled key, and the last key spilled
+    std::map<std::string, std::string> next_spilled_;
+    std::string last_spilled_;
+#endif
     size_t max_cache_size_;
 
   public:
     PolynomialStoreCache();
     explicit PolynomialStoreCache(size_t max_cache_size_);
+    PolynomialStoreCache(PolynomialStoreCache const& other);
+    PolynomialStoreCache(PolynomialStoreCache&& other) = default;
+    ~PolynomialStoreCache() = default;
+
+    PolynomialStoreCache& operator=(PolynomialStoreCache const& other);
+    PolynomialStoreCache& operator=(PolynomialStoreCache&& other) = default;
 
     void put(std::string const& key, Polynomial&& value);
 
@@ -33,6 +50,7 @@ class PolynomialStoreCache {
 
   private:
     void purge_until_free();
+    void rebuild_size_map();
 };
 
 } // namespace proof_system
\ No newline at end of file
@@ -0,0 +1,266 @@
+#ifndef __wasm__
+#include "polynomial_store_file.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <fcntl.h>
+#include <filesystem>
+#include <mutex>
+#include <sys/mman.h>
+#include <thread>
+#include <unistd.h>
+#include <unordered_map>
+
+namespace proof_system {
+
+template <typename Fr> struct PolynomialStoreFile<Fr>::State {
+    struct Entry {
+        size_t size = 0;
+        // The polynomial, until the writer has copied it into fd
+        Polynomial pending;
+        // Set if the writer could not copy `pending` into a file, which then stays in memory for good
+        bool write_failed = false;
+        int fd = -1;
+        // Incremented by each put of the key, so that the writer can tell whether it wrote the latest value
+        uint64_t generation = 0;
+    };
+
+    struct Job {
+        std::string key;
+        uint64_t generation;
+    };
+
+    std::string directory;
+    size_t max_pending_bytes;
+
+    mutable std::mutex mutex;
+    std::condition_variable jobs_changed;
+    std::unordered_map<std::string, Entry> entries;
+    std::deque<Job> jobs;
+    size_t pending_bytes = 0;
+    // The first write failure not yet reported to the caller
+    std::string error;
+    bool stopping = false;
+    // Started by the first put, so that a store that never spills costs no thread
+    std::thread writer;
+
+    State(std::string directory, size_t max_pending_bytes)
+        : directory(std::move(directory))
+        , max_pending_bytes(max_pending_bytes)
+    {}
+    State(State const& other) = delete;
+    State(State&& other) = delete;
+    State& operator=(State const& other) = delete;
+    State& operator=(State&& other) = delete;
+
+    ~State()
+    {
+        {
+            std::lock_guard lock(mutex);
+            stopping = true;
+        }
+        jobs_changed.notify_all();
+        if (writer.joinable()) {
+            writer.join();
+        }
+        for (auto& [key, entry] : entries) {
+            if (entry.fd >= 0) {
+                close(entry.fd);
+            }
+        }
+    }
+
+    void write_loop()
+    {
+        std::unique_lock lock(mutex);
+        while (true) {
+            jobs_changed.wait(lock, [&]() { return stopping || !jobs.empty(); });
+            if (jobs.empty()) {
+                return;
+            }
+            Job job = std::move(jobs.front());
+            jobs.pop_front();
+            Entry& entry = entries.at(job.key);
+            if (entry.generation != job.generation) {
+                // Overwritten before we got to it
+                continue;
+            }
+            // A share keeps the memory alive if the key is overwritten while we write
+            Polynomial polynomial = entry.pending.share();
+            const size_t size = entry.size;
+            lock.unlock();
+
+            int fd = -1;
+            try {
+                fd = write_file(polynomial, size);
+            } catch (std::exception const& e) {
+                lock.lock();
+                // The polynomial no longer waits for the writer, but stays in memory so that get() still works
+                Entry& failed = entries.at(job.key);
+                if (failed.generation == job.generation) {
+                    failed.write_failed = true;
+                    pending_bytes -= size * sizeof(Fr);
+                }
+                if (error.empty()) {
+                    error = std::string(e.what()) + " (writing " + job.key + ")";
+                }
+                jobs_changed.notify_all();
+                continue;
+            }
+
+            lock.lock();
+            Entry& written = entries.at(job.key);
+            if (written.generation == job.generation) {
+                written.fd = fd;
+                written.pending = Polynomial();
+                pending_bytes -= size * sizeof(Fr);
+            } else if (fd >= 0) {
+                close(fd);
+            }
+            jobs_changed.notify_all();
+        }
+    }
+
+    // Throws the pending write failure, if any, once: later puts start afresh. Must be called with the mutex held.
+    void report_error()
+    {
+        if (!error.empty()) {
+            std::string message = std::move(error);
+            error.clear();
+            throw_or_abort(message);
+        }
+    }
+
+    // Copies the polynomial into a new unlinked file through a shared mapping, leaving the writeback to the kernel
+    int write_file(Polynomial const& polynomial, size_t size) const
+    {
+        const size_t num_bytes = size * sizeof(Fr);
+        if (num_bytes == 0) {
+            return -1;
+        }
+        std::string path = directory + "/bb_polynomial_XXXXXX";
+        const int fd = mkstemp(path.data());
+        if (fd < 0) {
+            throw_or_abort("PolynomialStoreFile: could not create a file in " + directory);
+        }
+        unlink(path.c_str());
+        if (ftruncate(fd, static_cast<off_t>(num_bytes)) != 0) {
+            close(fd);
+            throw_or_abort("PolynomialStoreFile: could not allocate a file of " + std::to_string(num_bytes) + " bytes");
+        }
+        void* map = mmap(nullptr, num_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (map == MAP_FAILED) {
+            close(fd);
+            throw_or_abort("PolynomialStoreFile: could not map a file");
+        }
+        std::memcpy(map, static_cast<const void*>(polynomial.begin()), num_bytes);
+        msync(map, num_bytes, MS_ASYNC);
+        munmap(map, num_bytes);
+        return fd;
+    }
+};
+
+template <typename Fr>
+PolynomialStoreFile<Fr>::PolynomialStoreFile()
+    : PolynomialStoreFile(std::filesystem::temp_directory_path().string())
+{}
+
+template <typename Fr>
+PolynomialStoreFile<Fr>::PolynomialStoreFile(std::string const& directory, size_t max_pending_bytes)
+    : state_(std::make_shared<State>(directory, max_pending_bytes))
+{}
+
+template <typename Fr> void PolynomialStoreFile<Fr>::put(std::string const& key, Polynomial&& value)
+{
+    State& state = *state_;
+    std::unique_lock lock(state.mutex);
+    auto& entry = state.entries[key];
+    if (entry.fd >= 0) {
+        close(entry.fd);
+        entry.fd = -1;
+    }
+    if (!entry.pending.is_empty() && !entry.write_failed) {
+        state.pending_bytes -= entry.size * sizeof(Fr);
+    }
+    entry.size = value.size();
+    entry.pending = std::move(value);
+    entry.write_failed = false;
+    entry.generation++;
+    state.pending_bytes += entry.size * sizeof(Fr);
+    state.jobs.push_back({ key, entry.generation });
+    if (!state.writer.joinable()) {
+        state.writer = std::thread([&state]() { state.write_loop(); });
+    }
+    state.jobs_changed.notify_all();
+
+    // Bound the memory held by polynomials in flight, but always let one through
+    state.jobs_changed.wait(lock, [&]() {
+        return state.pending_bytes <= state.max_pending_bytes || state.jobs.empty() || !state.error.empty();
+    });
+    state.report_error();
+};
+
+template <typename Fr> barretenberg::Polynomial<Fr> PolynomialStoreFile<Fr>::get(std::string const& key)
+{
+    State& state = *state_;
+    std::unique_lock lock(state.mutex);
+    auto& entry = state.entries.at(key);
+    if (!entry.pending.is_empty()) {
+        return Polynomial(entry.pending);
+    }
+    const size_t size = entry.size;
+    const int fd = entry.fd;
+    lock.unlock();
+
+    // Only empty polynomials have no file, every other result is overwritten in full by the file's contents
+    Polynomial result(size, barretenberg::DontZeroMemory::FLAG);
+    if (fd < 0) {
+        return result;
+    }
+    const size_t num_bytes = size * sizeof(Fr);
+    // Populating the mapping reads the whole file in, with read-ahead, instead of a page fault at a time
+    void* map = mmap(nullptr, num_bytes, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0);
+    if (map == MAP_FAILED) {
+        throw_or_abort("PolynomialStoreFile: could not map the file of " + key);
+    }
+    std::memcpy(static_cast<void*>(result.begin()), map, num_bytes);
+    munmap(map, num_bytes);
+    return result;
+};
+
+template <typename Fr> void PolynomialStoreFile<Fr>::prefetch(std::string const& key)
+{
+    State& state = *state_;
+    std::lock_guard lock(state.mutex);
+    auto it = state.entries.find(key);
+    if (it != state.entries.end() && it->second.fd >= 0) {
+        posix_fadvise(it->second.fd, 0, static_cast<off_t>(it->second.size * sizeof(Fr)), POSIX_FADV_WILLNEED);
+    }
+}
+
+template <typename Fr> void PolynomialStoreFile<Fr>::flush()
+{
+    State& state = *state_;
+    std::unique_lock lock(state.mutex);
+    state.jobs_changed.wait(
+        lock, [&]() { return (state.pending_bytes == 0 && state.jobs.empty()) || !state.error.empty(); });
+    state.report_error();
+}
+
+template <typename Fr> bool PolynomialStoreFile<Fr>::contains(std::string const& key) const
+{
+    std::lock_guard lock(state_->mutex);
+    return state_->entries.contains(key);
+}
+
+template <typename Fr> size_t PolynomialStoreFile<Fr>::get_pending_bytes() const
+{
+    std::lock_guard lock(state_->mutex);
+    return state_->pending_bytes;
+}
+
+template class PolynomialStoreFile<barretenberg::fr>;
+
+} // namespace proof_system
+#endif
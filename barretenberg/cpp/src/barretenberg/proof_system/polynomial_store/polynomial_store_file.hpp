@@ -0,0 +1,56 @@
+#pragma once
+#include "barretenberg/polynomials/polynomial.hpp"
+#include <memory>
+#include <string>
+
+namespace proof_system {
+
+/**
+ * The native counterpart of PolynomialStoreWasm: an external store for PolynomialStoreCache that spills polynomials to
+ * memory mapped temporary files, so that a prover's memory is bounded by the cache rather than by the circuit.
+ *
+ * Writes are asynchronous. put() hands the polynomial to a writer thread and returns, the polynomial's memory is
+ * released once it has been copied into its file, and the kernel writes the file back in its own time. At most
+ * max_pending_bytes of polynomials wait for the writer, put() blocks beyond that. A polynomial that cannot be written
+ * stays in memory, and the next put() or flush() throws the error (once). get() maps the file with read-ahead of the
+ * whole file and copies it into a new polynomial; prefetch() starts that read-ahead early, for a caller that knows
+ * which polynomial it needs next.
+ *
+ * The files are unlinked as soon as they are created, so they go away with the store even if the process dies. Copies
+ * of a store share its files, like all instances of PolynomialStoreWasm share the host's data store. Like the other
+ * stores, it must be used from one thread at a time.
+ */
+template <typename Fr> class PolynomialStoreFile {
+  private:
+    using Polynomial = barretenberg::Polynomial<Fr>;
+    struct State;
+    std::shared_ptr<State> state_;
+
+  public:
+    static constexpr size_t DEFAULT_MAX_PENDING_BYTES = size_t(1) << 28;
+
+    // Spills to the system's temporary directory, i.e. $TMPDIR or /tmp
+    PolynomialStoreFile();
+    explicit PolynomialStoreFile(std::string const& directory, size_t max_pending_bytes = DEFAULT_MAX_PENDING_BYTES);
+
+    void put(std::string const& key, Polynomial&& value);
+
+    /**
+     * Returns a copy of the polynomial. Throws std::out_of_range if the key does not exist.
+     */
+    Polynomial get(std::string const& key);
+
+    void prefetch(std::string const& key);
+
+    // Blocks until every polynomial put so far is in its file
+    void flush();
+
+    bool contains(std::string const& key) const;
+
+    // The number of bytes of polynomials that are waiting for the writer
+    size_t get_pending_bytes() const;
+};
+
+extern template class PolynomialStoreFile<barretenberg::fr>;
+
+} // namespace proof_system
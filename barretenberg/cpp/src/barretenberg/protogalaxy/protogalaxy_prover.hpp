@@ -1,5 +1,6 @@
 #pragma once
 #include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/thread_utils.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/flavor/goblin_ultra.hpp"
@@ -146,6 +147,7 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
      * @brief Compute the values of the full Honk relation at each row in the execution trace, f_i(ω) in the
      * ProtoGalaxy paper, given the evaluations of all the prover polynomials and α (the parameter that helps establish
      * each subrelation is independently valid in Honk - from the Plonk paper, DO NOT confuse with α in ProtoGalaxy),
+     * @details The rows are split into contiguous ranges, one per thread.
      */
     static std::vector<FF> compute_full_honk_evaluations(const ProverPolynomials& instance_polynomials,
                                                          const FF& alpha,
@@ -153,54 +155,69 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
     {
         auto instance_size = instance_polynomials.get_polynomial_size();
 
+        size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
+        size_t num_threads =
+            barretenberg::thread_utils::calculate_num_threads(instance_size, min_iterations_per_thread);
+        size_t iterations_per_thread = instance_size / num_threads;
+
         std::vector<FF> full_honk_evaluations(instance_size);
-        for (size_t row = 0; row < instance_size; row++) {
-            auto row_evaluations = instance_polynomials.get_row(row);
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            size_t start = thread_idx * iterations_per_thread;
+            size_t end = (thread_idx == num_threads - 1) ? instance_size : start + iterations_per_thread;
             RelationEvaluations relation_evaluations;
-            Utils::zero_elements(relation_evaluations);
-
-            // Note that the evaluations are accumulated with the gate separation challenge being 1 at this stage, as
-            // this specific randomness is added later through the power polynomial univariate specific to ProtoGalaxy
-            Utils::template accumulate_relation_evaluations<>(
-                row_evaluations, relation_evaluations, relation_parameters, FF(1));
-
-            auto running_challenge = FF(1);
-            auto output = FF(0);
-            Utils::scale_and_batch_elements(relation_evaluations, alpha, running_challenge, output);
-            full_honk_evaluations[row] = output;
-        }
+            flavor::RowBlock<typename Flavor::AllValues> row_block;
+            for (size_t block_start = start; block_start < end; block_start += row_block.capacity()) {
+                row_block.load(instance_polynomials, block_start, std::min(row_block.capacity(), end - block_start));
+                for (size_t i = 0; i < row_block.size(); i++) {
+                    Utils::zero_elements(relation_evaluations);
+
+                    // Note that the evaluations are accumulated with the gate separation challenge being 1 at this
+                    // stage, as this specific randomness is added later through the power polynomial univariate
+                    // specific to ProtoGalaxy
+                    Utils::template accumulate_relation_evaluations<>(
+                        row_block[i], relation_evaluations, relation_parameters, FF(1));
+
+                    auto running_challenge = FF(1);
+                    auto output = FF(0);
+                    Utils::scale_and_batch_elements(relation_evaluations, alpha, running_challenge, output);
+                    full_honk_evaluations[block_start + i] = output;
+                }
+            }
+        });
         return full_honk_evaluations;
     }
 
     /**
-     * @brief  Recursively compute the parent nodes of each level in there, starting from the leaves. Note that at each
-     * level, the resulting parent nodes will be polynomials of degree (level + 1) because we multiply by an additional
-     * factor of X.
+     * @brief Computes `num_levels` levels of the perturbator's coefficient tree, in place. On entry, `coeffs` holds
+     * `num_nodes` nodes of `level` back to back, each a polynomial of degree `level` (so level + 1 coefficients); on
+     * return it starts with their num_nodes / 2^num_levels ancestors, laid out the same way.
+     * @details A parent, n_l + n_r * (β_i + δ_i X), is never stored past the start of its left child n_l, and its d-th
+     * coefficient only depends on coefficients d and d - 1 of its children, so each level can overwrite the one below
+     * it front to back.
      */
-    static std::vector<FF> construct_coefficients_tree(const std::vector<FF>& betas,
-                                                       const std::vector<FF>& deltas,
-                                                       const std::vector<std::vector<FF>>& prev_level_coeffs,
-                                                       size_t level = 1)
+    static void construct_coefficients_tree_in_place(std::span<FF> coeffs,
+                                                     const std::vector<FF>& betas,
+                                                     const std::vector<FF>& deltas,
+                                                     size_t num_nodes,
+                                                     size_t level,
+                                                     size_t num_levels)
     {
-        // if we are at level t in the tree, where t = logn and n is the instance size, we have reached the root which
-        // contains the coefficients of the perturbator polynomial
-        if (level == betas.size()) {
-            return prev_level_coeffs[0];
-        }
-
-        auto degree = level + 1;
-        auto prev_level_width = prev_level_coeffs.size();
-        // we need degree + 1 terms to represent the intermediate polynomials
-        std::vector<std::vector<FF>> level_coeffs(prev_level_width >> 1, std::vector<FF>(degree + 1, 0));
-        for (size_t node = 0; node < prev_level_width; node += 2) {
-            auto parent = node >> 1;
-            std::copy(prev_level_coeffs[node].begin(), prev_level_coeffs[node].end(), level_coeffs[parent].begin());
-            for (size_t d = 0; d < degree; d++) {
-                level_coeffs[parent][d] += prev_level_coeffs[node + 1][d] * betas[level];
-                level_coeffs[parent][d + 1] += prev_level_coeffs[node + 1][d] * deltas[level];
+        for (size_t end_level = level + num_levels; level < end_level; level++, num_nodes >>= 1) {
+            const size_t child_size = level + 1;
+            const size_t parent_size = level + 2;
+            for (size_t parent = 0; parent < (num_nodes >> 1); parent++) {
+                const size_t left = parent * 2 * child_size;
+                const size_t right = left + child_size;
+                // Both children are read before the coefficient that may overlap them is written
+                FF previous_right = 0;
+                for (size_t d = 0; d < child_size; d++) {
+                    const FF right_d = coeffs[right + d];
+                    coeffs[parent * parent_size + d] = coeffs[left + d] + right_d * betas[level] + previous_right;
+                    previous_right = right_d * deltas[level];
+                }
+                coeffs[parent * parent_size + child_size] = previous_right;
             }
         }
-        return construct_coefficients_tree(betas, deltas, level_coeffs, level + 1);
     }
 
     /**
@@ -210,21 +227,47 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
      * the tree, label the branch connecting the left node n_l to its parent by 1 and for the right node n_r by β_i +
      * δ_i X. The value of the parent node n will be constructed as n = n_l + n_r * (β_i + δ_i X). Recurse over each
      * layer until the root is reached which will correspond to the perturbator polynomial F(X).
-     * TODO(https://github.com/AztecProtocol/barretenberg/issues/745): make computation of perturbator more memory
-     * efficient, operate in-place and use std::resize; add multithreading
+     * @details The tree is built in the buffer of the evaluations themselves (see
+     * construct_coefficients_tree_in_place). Each thread reduces a contiguous range of the leaves to the root of its
+     * subtree, then the (few) subtree roots are gathered at the front of the buffer and reduced to the root.
      */
     static std::vector<FF> construct_perturbator_coefficients(const std::vector<FF>& betas,
                                                               const std::vector<FF>& deltas,
-                                                              const std::vector<FF>& full_honk_evaluations)
+                                                              std::vector<FF> full_honk_evaluations)
     {
-        auto width = full_honk_evaluations.size();
-        std::vector<std::vector<FF>> first_level_coeffs(width >> 1, std::vector<FF>(2, 0));
-        for (size_t node = 0; node < width; node += 2) {
-            auto parent = node >> 1;
-            first_level_coeffs[parent][0] = full_honk_evaluations[node] + full_honk_evaluations[node + 1] * betas[0];
-            first_level_coeffs[parent][1] = full_honk_evaluations[node + 1] * deltas[0];
+        const size_t width = full_honk_evaluations.size();
+        const size_t log_width = betas.size();
+        ASSERT(width == (size_t(1) << log_width));
+        std::span<FF> coeffs(full_honk_evaluations);
+
+        size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
+        size_t num_threads = barretenberg::thread_utils::calculate_num_threads_pow2(width, min_iterations_per_thread);
+        size_t leaves_per_thread = width / num_threads;
+        size_t log_leaves_per_thread = static_cast<size_t>(numeric::get_msb(leaves_per_thread));
+
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            construct_coefficients_tree_in_place(coeffs.subspan(thread_idx * leaves_per_thread, leaves_per_thread),
+                                                 betas,
+                                                 deltas,
+                                                 leaves_per_thread,
+                                                 0,
+                                                 log_leaves_per_thread);
+        });
+
+        // Each subtree root has log_leaves_per_thread + 1 coefficients, and is moved no further than the front of its
+        // own range
+        const size_t root_size = log_leaves_per_thread + 1;
+        for (size_t thread_idx = 1; thread_idx < num_threads; thread_idx++) {
+            auto root = coeffs.begin() + static_cast<std::ptrdiff_t>(thread_idx * leaves_per_thread);
+            std::copy(root,
+                      root + static_cast<std::ptrdiff_t>(root_size),
+                      coeffs.begin() + static_cast<std::ptrdiff_t>(thread_idx * root_size));
         }
-        return construct_coefficients_tree(betas, deltas, first_level_coeffs);
+        construct_coefficients_tree_in_place(
+            coeffs, betas, deltas, num_threads, log_leaves_per_thread, log_width - log_leaves_per_thread);
+
+        full_honk_evaluations.resize(log_width + 1);
+        return full_honk_evaluations;
     }
 
     /**
@@ -240,7 +283,7 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
             accumulator->prover_polynomials, accumulator->alpha, accumulator->relation_parameters);
         const auto betas = accumulator->folding_parameters.gate_challenges;
         assert(betas.size() == deltas.size());
-        auto coeffs = construct_perturbator_coefficients(betas, deltas, full_honk_evaluations);
+        auto coeffs = construct_perturbator_coefficients(betas, deltas, std::move(full_honk_evaluations));
         return Polynomial<FF>(coeffs);
     }
 
@@ -22,6 +22,8 @@ template <typename Curve> class ProverCrs {
 
     /**
      *  @brief Returns the monomial points in a form to be consumed by scalar_multiplication pippenger algorithm.
+     *  @details The points are read-only, whatever the pointer type: they may live in a read-only mapping shared with
+     *  other processes (see MappedProverCrs), where a write faults.
      */
     virtual typename Curve::AffineElement* get_monomial_points() = 0;
     virtual size_t get_monomial_size() const = 0;
@@ -6,6 +6,13 @@
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include <cstdio>
+
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 namespace barretenberg::srs::factories {
 
@@ -48,8 +55,75 @@ size_t FileVerifierCrs<curve::Grumpkin>::get_monomial_size() const
 }
 
 template <typename Curve>
-FileCrsFactory<Curve>::FileCrsFactory(std::string path, size_t initial_degree)
+MappedProverCrs<Curve>::MappedProverCrs(const size_t num_points,
+                                        std::string const& path,
+                                        std::string const& cache_path)
+    : num_points(num_points)
+{
+    using IO = srs::IO<Curve>;
+    using AffineElement = typename Curve::AffineElement;
+
+    const auto load_point_table = [&]() {
+        auto table = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+        IO::read_transcript_g1(table.get(), num_points, path);
+        scalar_multiplication::generate_pippenger_point_table<Curve>(table.get(), table.get(), num_points);
+        return table;
+    };
+
+#ifdef __wasm__
+    // No mmap in wasi, behave like FileProverCrs.
+    static_cast<void>(cache_path);
+    fallback_monomials_ = load_point_table();
+    monomials_ = fallback_monomials_.get();
+#else
+    if (!IO::is_point_table_cache_valid(cache_path, num_points)) {
+        auto table = load_point_table();
+
+        // Write to a process-unique file and rename it into place, so that concurrent provers never map a partially
+        // written cache, and processes still mapping a previous (smaller) cache keep their view of it.
+        const std::string tmp_path = format(cache_path, ".tmp.", getpid());
+        if (!IO::write_point_table_cache(table.get(), num_points, tmp_path) ||
+            std::rename(tmp_path.c_str(), cache_path.c_str()) != 0) {
+            std::remove(tmp_path.c_str());
+            info("Could not write point table cache to ", cache_path, ", keeping point table in memory.");
+            fallback_monomials_ = table;
+            monomials_ = fallback_monomials_.get();
+            return;
+        }
+    }
+
+    // We only map the prefix we need, the cache may hold a larger srs.
+    const size_t mapping_size = IO::get_point_table_cache_size(num_points);
+    int fd = open(cache_path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw_or_abort(format("Could not open point table cache ", cache_path, "."));
+    }
+    void* mapping = mmap(nullptr, mapping_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        throw_or_abort(format("Could not map point table cache ", cache_path, "."));
+    }
+    madvise(mapping, mapping_size, MADV_WILLNEED);
+    mapping_ = mapping;
+    mapping_size_ = mapping_size;
+    monomials_ =
+        reinterpret_cast<const AffineElement*>(static_cast<const char*>(mapping) + sizeof(PointTableCacheHeader));
+#endif
+}
+
+template <typename Curve> MappedProverCrs<Curve>::~MappedProverCrs()
+{
+#ifndef __wasm__
+    if (mapping_ != nullptr) {
+        munmap(mapping_, mapping_size_);
+    }
+#endif
+}
+
+template <typename Curve>
+FileCrsFactory<Curve>::FileCrsFactory(std::string path, size_t initial_degree, std::string point_table_cache_path)
     : path_(std::move(path))
+    , point_table_cache_path_(std::move(point_table_cache_path))
     , degree_(initial_degree)
 {}
 
@@ -57,7 +131,11 @@ template <typename Curve>
 std::shared_ptr<barretenberg::srs::factories::ProverCrs<Curve>> FileCrsFactory<Curve>::get_prover_crs(size_t degree)
 {
     if (degree != degree_ || !prover_crs_) {
-        prover_crs_ = std::make_shared<FileProverCrs<Curve>>(degree, path_);
+        if (point_table_cache_path_.empty()) {
+            prover_crs_ = std::make_shared<FileProverCrs<Curve>>(degree, path_);
+        } else {
+            prover_crs_ = std::make_shared<MappedProverCrs<Curve>>(degree, path_, point_table_cache_path_);
+        }
         degree_ = degree;
     }
     return prover_crs_;
@@ -75,6 +153,8 @@ std::shared_ptr<barretenberg::srs::factories::VerifierCrs<Curve>> FileCrsFactory
 
 template class FileProverCrs<curve::BN254>;
 template class FileProverCrs<curve::Grumpkin>;
+template class MappedProverCrs<curve::BN254>;
+template class MappedProverCrs<curve::Grumpkin>;
 template class FileCrsFactory<curve::BN254>;
 template class FileCrsFactory<curve::Grumpkin>;
 
@@ -12,10 +12,13 @@ namespace barretenberg::srs::factories {
 
 /**
  * Create reference strings given a path to a directory of transcript files.
+ *
+ * If a `point_table_cache_path` is given, prover crs's are served from a native point table cache at that path (see
+ * MappedProverCrs) rather than being read from the transcripts on every construction.
  */
 template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
   public:
-    FileCrsFactory(std::string path, size_t initial_degree = 0);
+    FileCrsFactory(std::string path, size_t initial_degree = 0, std::string point_table_cache_path = "");
     FileCrsFactory(FileCrsFactory&& other) = default;
 
     std::shared_ptr<barretenberg::srs::factories::ProverCrs<Curve>> get_prover_crs(size_t degree) override;
@@ -24,6 +27,7 @@ template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
 
   private:
     std::string path_;
+    std::string point_table_cache_path_;
     size_t degree_;
     std::shared_ptr<barretenberg::srs::factories::ProverCrs<Curve>> prover_crs_;
     std::shared_ptr<barretenberg::srs::factories::VerifierCrs<Curve>> verifier_crs_;
@@ -49,6 +53,41 @@ template <typename Curve> class FileProverCrs : public ProverCrs<Curve> {
     std::shared_ptr<typename Curve::AffineElement[]> monomials_;
 };
 
+/**
+ * A prover crs backed by a memory-mapped point table cache.
+ *
+ * @details The first construction for a given cache path reads the transcripts, builds the pippenger point table and
+ * writes it out as a PointTableCacheHeader-prefixed file (atomically, via a rename). Every construction then maps the
+ * file read-only, so the table is neither byteswapped nor expanded again, and processes on the same host share its
+ * physical pages through the page cache. A cache holding more points than requested is used as-is, since the point
+ * table of a prefix of the srs is a prefix of the point table.
+ *
+ * If the cache cannot be written (e.g. a read-only directory) we fall back to keeping the table in memory, exactly as
+ * FileProverCrs does.
+ */
+template <typename Curve> class MappedProverCrs : public ProverCrs<Curve> {
+  public:
+    MappedProverCrs(const size_t num_points, std::string const& path, std::string const& cache_path);
+    MappedProverCrs(const MappedProverCrs&) = delete;
+    MappedProverCrs& operator=(const MappedProverCrs&) = delete;
+    ~MappedProverCrs() override;
+
+    // The table may be the PROT_READ mapping, the pippenger API only takes mutable pointers but never writes the points
+    typename Curve::AffineElement* get_monomial_points() override
+    {
+        return const_cast<typename Curve::AffineElement*>(monomials_);
+    }
+
+    [[nodiscard]] size_t get_monomial_size() const override { return num_points; }
+
+  private:
+    size_t num_points;
+    const typename Curve::AffineElement* monomials_ = nullptr;
+    void* mapping_ = nullptr;
+    size_t mapping_size_ = 0;
+    std::shared_ptr<typename Curve::AffineElement[]> fallback_monomials_;
+};
+
 template <typename Curve> class FileVerifierCrs : public VerifierCrs<Curve> {
   public:
     FileVerifierCrs(std::string const& path, const size_t num_points);
@@ -88,5 +127,7 @@ template <> class FileVerifierCrs<curve::Grumpkin> : public VerifierCrs<curve::G
 
 extern template class FileProverCrs<curve::BN254>;
 extern template class FileProverCrs<curve::Grumpkin>;
+extern template class MappedProverCrs<curve::BN254>;
+extern template class MappedProverCrs<curve::Grumpkin>;
 
 } // namespace barretenberg::srs::factories
@@ -46,6 +46,13 @@ MemBn254CrsFactory::MemBn254CrsFactory(std::vector<g1::affine_element> const& po
     , verifier_crs_(std::make_shared<MemVerifierCrs>(g2_point))
 {}
 
+MemBn254CrsFactory::MemBn254CrsFactory(std::shared_ptr<g1::affine_element[]> point_table,
+                                       size_t num_points,
+                                       g2::affine_element const& g2_point)
+    : prover_crs_(std::make_shared<MemProverCrs<curve::BN254>>(std::move(point_table), num_points))
+    , verifier_crs_(std::make_shared<MemVerifierCrs>(g2_point))
+{}
+
 std::shared_ptr<barretenberg::srs::factories::ProverCrs<curve::BN254>> MemBn254CrsFactory::get_prover_crs(size_t)
 {
     return prover_crs_;
@@ -16,6 +16,10 @@ namespace barretenberg::srs::factories {
 class MemBn254CrsFactory : public CrsFactory<curve::BN254> {
   public:
     MemBn254CrsFactory(std::vector<g1::affine_element> const& points, g2::affine_element const& g2_point);
+    // Construct from an already generated pippenger point table of `num_points` points.
+    MemBn254CrsFactory(std::shared_ptr<g1::affine_element[]> point_table,
+                       size_t num_points,
+                       g2::affine_element const& g2_point);
     MemBn254CrsFactory(MemBn254CrsFactory&& other) = default;
 
     std::shared_ptr<barretenberg::srs::factories::ProverCrs<curve::BN254>> get_prover_crs(size_t degree) override;
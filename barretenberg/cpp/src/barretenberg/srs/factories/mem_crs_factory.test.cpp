@@ -4,6 +4,7 @@
 #include "barretenberg/srs/factories/mem_bn254_crs_factory.hpp"
 #include "barretenberg/srs/factories/mem_grumpkin_crs_factory.hpp"
 #include "file_crs_factory.hpp"
+#include <filesystem>
 #include <fstream>
 #include <gtest/gtest.h>
 
@@ -74,3 +75,35 @@ TEST(reference_string, mem_grumpkin_file_consistency)
                      sizeof(Grumpkin::AffineElement) * 1024 * 2),
               0);
 }
+
+TEST(reference_string, mapped_point_table_cache_consistency)
+{
+    auto cache_path = std::filesystem::temp_directory_path() / "bb_mapped_point_table_cache_test.dat";
+    std::filesystem::remove(cache_path);
+
+    auto file_crs = FileCrsFactory<BN254>("../srs_db/ignition", 1024);
+    auto file_prover_crs = file_crs.get_prover_crs(1024);
+
+    // The first factory writes the cache, the second one only maps it.
+    for (size_t i = 0; i < 2; ++i) {
+        auto mapped_crs = FileCrsFactory<BN254>("../srs_db/ignition", 0, cache_path);
+        auto mapped_prover_crs = mapped_crs.get_prover_crs(1024);
+        EXPECT_TRUE(std::filesystem::exists(cache_path));
+        EXPECT_EQ(mapped_prover_crs->get_monomial_size(), 1024);
+        EXPECT_EQ(memcmp(mapped_prover_crs->get_monomial_points(),
+                         file_prover_crs->get_monomial_points(),
+                         sizeof(g1::affine_element) * 1024 * 2),
+                  0);
+    }
+
+    // A smaller srs is served from the existing cache.
+    auto mapped_crs = FileCrsFactory<BN254>("../srs_db/ignition", 0, cache_path);
+    auto mapped_prover_crs = mapped_crs.get_prover_crs(512);
+    EXPECT_EQ(mapped_prover_crs->get_monomial_size(), 512);
+    EXPECT_EQ(memcmp(mapped_prover_crs->get_monomial_points(),
+                     file_prover_crs->get_monomial_points(),
+                     sizeof(g1::affine_element) * 512 * 2),
+              0);
+
+    std::filesystem::remove(cache_path);
+}
@@ -16,6 +16,14 @@ template <typename Curve> class MemProverCrs : public ProverCrs<Curve> {
         scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
     }
 
+    /**
+     * @brief Take ownership of an already generated pippenger point table of `num_points` points.
+     */
+    MemProverCrs(std::shared_ptr<typename Curve::AffineElement[]> point_table, size_t num_points)
+        : num_points(num_points)
+        , monomials_(std::move(point_table))
+    {}
+
     typename Curve::AffineElement* get_monomial_points() override { return monomials_.get(); }
 
     size_t get_monomial_size() const override { return num_points; }
@@ -18,12 +18,26 @@ void init_crs_factory(std::vector<g1::affine_element> const& points, g2::affine_
     crs_factory = std::make_shared<factories::MemBn254CrsFactory>(points, g2_point);
 }
 
+// Initializes the crs using an already generated pippenger point table
+void init_crs_factory(std::shared_ptr<g1::affine_element[]> const& point_table,
+                      size_t num_points,
+                      g2::affine_element const g2_point)
+{
+    crs_factory = std::make_shared<factories::MemBn254CrsFactory>(point_table, num_points, g2_point);
+}
+
 // Initializes crs from a file path this we use in the entire codebase
 void init_crs_factory(std::string crs_path)
 {
     crs_factory = std::make_shared<factories::FileCrsFactory<curve::BN254>>(crs_path);
 }
 
+// Initializes crs from a file path, serving prover crs's from a memory-mapped point table cache
+void init_crs_factory(std::string crs_path, std::string point_table_cache_path)
+{
+    crs_factory = std::make_shared<factories::FileCrsFactory<curve::BN254>>(crs_path, 0, point_table_cache_path);
+}
+
 // Initializes the crs using the memory buffers
 void init_grumpkin_crs_factory(std::vector<curve::Grumpkin::AffineElement> const& points)
 {
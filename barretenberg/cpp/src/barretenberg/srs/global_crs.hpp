@@ -6,12 +6,16 @@ namespace barretenberg::srs {
 
 // Initializes the crs using files
 void init_crs_factory(std::string crs_path);
+void init_crs_factory(std::string crs_path, std::string point_table_cache_path);
 void init_grumpkin_crs_factory(std::string crs_path);
 
 // Initializes the crs using memory buffers
 void init_grumpkin_crs_factory(std::vector<curve::Grumpkin::AffineElement> const& points);
 void init_crs_factory(std::vector<barretenberg::g1::affine_element> const& points,
                       barretenberg::g2::affine_element const g2_point);
+void init_crs_factory(std::shared_ptr<barretenberg::g1::affine_element[]> const& point_table,
+                      size_t num_points,
+                      barretenberg::g2::affine_element const g2_point);
 
 std::shared_ptr<barretenberg::srs::factories::CrsFactory<curve::BN254>> get_crs_factory();
 std::shared_ptr<barretenberg::srs::factories::CrsFactory<curve::Grumpkin>> get_grumpkin_crs_factory();
@@ -45,6 +45,27 @@ struct Manifest {
     uint32_t start_from;
 };
 
+/**
+ * @brief Header of a native point table cache file
+ *
+ * @details A point table cache holds the pippenger point table (see `generate_pippenger_point_table`) of the first
+ * `num_points` G1 points of a transcript, laid out exactly as it is consumed by scalar multiplication: native endian,
+ * in Montgomery form, with every point followed by its endomorphism. It can therefore be memory-mapped and used as-is.
+ *
+ * The header is padded to 64 bytes so that the table which follows it stays cache-line aligned.
+ */
+struct PointTableCacheHeader {
+    static constexpr uint64_t MAGIC = 0x454C424154544E50; // "PNTTABLE", read back in native byte order
+    static constexpr uint64_t VERSION = 1;
+
+    uint64_t magic;
+    uint64_t version;
+    uint64_t modulus_tag; // lowest limb of the base field modulus, distinguishes caches of different curves
+    uint64_t num_points;
+    uint64_t reserved[4];
+};
+static_assert(sizeof(PointTableCacheHeader) == 64);
+
 // Detect whether a curve has a G2AffineElement defined
 template <typename Curve>
 concept HasG2 = requires { typename Curve::G2AffineElement; };
@@ -368,6 +389,55 @@ template <typename Curve> class IO {
         read_transcript_g1(monomials, degree, path);
     }
 
+    /**
+     * @brief Check that `path` holds a point table cache for this curve covering at least `num_points` points.
+     */
+    static bool is_point_table_cache_valid(std::string const& path, size_t num_points)
+    {
+        PointTableCacheHeader header;
+        std::ifstream file;
+        file.open(path, std::ifstream::binary);
+        file.read((char*)&header, sizeof(PointTableCacheHeader));
+        if (!file) {
+            return false;
+        }
+        file.close();
+
+        if (header.magic != PointTableCacheHeader::MAGIC || header.version != PointTableCacheHeader::VERSION ||
+            header.modulus_tag != Fq::modulus.data[0] || header.num_points < num_points) {
+            return false;
+        }
+        return get_file_size(path) >= get_point_table_cache_size(header.num_points);
+    }
+
+    /**
+     * @brief Size in bytes of a point table cache file holding `num_points` points (i.e. 2 * num_points table entries).
+     */
+    static size_t get_point_table_cache_size(size_t num_points)
+    {
+        return sizeof(PointTableCacheHeader) + sizeof(AffineElement) * 2 * num_points;
+    }
+
+    /**
+     * @brief Write the pippenger point table of `num_points` points to `path` as a point table cache.
+     *
+     * @return false if the file could not be written, in which case its contents are unspecified.
+     */
+    static bool write_point_table_cache(AffineElement const* table, size_t num_points, std::string const& path)
+    {
+        PointTableCacheHeader header{ .magic = PointTableCacheHeader::MAGIC,
+                                      .version = PointTableCacheHeader::VERSION,
+                                      .modulus_tag = Fq::modulus.data[0],
+                                      .num_points = num_points,
+                                      .reserved = {} };
+        std::ofstream file;
+        file.open(path, std::ofstream::binary | std::ofstream::trunc);
+        file.write((char const*)&header, sizeof(PointTableCacheHeader));
+        file.write((char const*)table, (std::streamsize)(sizeof(AffineElement) * 2 * num_points));
+        file.close();
+        return !file.fail();
+    }
+
     // This function is a vestige of the Lagrange form transcript work, and it is not used anywhere.
     static void write_transcript(AffineElement const* g1_x,
                                  auto const* g2_x,
@@ -12,11 +12,13 @@
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/test.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_point_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
 #include "barretenberg/srs/io.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <vector>
 
@@ -976,6 +978,172 @@ TYPED_TEST(ScalarMultiplicationTests, PippengerUnsafeShortInputs)
     EXPECT_EQ(result == expected, true);
 }
 
+TYPED_TEST(ScalarMultiplicationTests, PippengerFixedBase)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 8192;
+    constexpr size_t memory_budget = 16 * 1024 * 1024;
+
+    std::vector<Fr> scalars(num_points);
+    auto points = barretenberg::scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[i] = Fr::random_element();
+        points.get()[i] = AffineElement(Element::random_element());
+    }
+    // a run of equal scalars puts many points into the same bucket
+    for (size_t i = 0; i < num_points / 4; ++i) {
+        scalars[i] = Fr(7);
+    }
+    barretenberg::scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+
+    barretenberg::scalar_multiplication::fixed_base_point_table<Curve> point_table(
+        points.get(), num_points, memory_budget);
+    EXPECT_FALSE(point_table.empty());
+    EXPECT_LE(point_table.get_memory_usage(), memory_budget);
+
+    barretenberg::scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+    // include a size that is not a power of two, to exercise the leftover slices
+    for (const size_t num_msm_points : { num_points, num_points - 3 }) {
+        Element expected = barretenberg::scalar_multiplication::pippenger_unsafe<Curve>(
+            &scalars[0], points.get(), num_msm_points, state);
+        Element result = barretenberg::scalar_multiplication::pippenger_fixed_base<Curve>(
+            &scalars[0], point_table, num_msm_points, state);
+        EXPECT_EQ(result.normalize(), expected.normalize());
+    }
+
+    // a budget that cannot fit two copies leaves the table empty
+    barretenberg::scalar_multiplication::fixed_base_point_table<Curve> empty_table(
+        points.get(), num_points, num_points * 2 * sizeof(AffineElement));
+    EXPECT_TRUE(empty_table.empty());
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerSparse)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 8192;
+
+    std::vector<Fr> scalars(num_points, Fr::zero());
+    auto points = barretenberg::scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        points.get()[i] = AffineElement(Element::random_element());
+    }
+    barretenberg::scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+
+    barretenberg::scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+    const auto check = [&]() {
+        Element expected =
+            barretenberg::scalar_multiplication::pippenger_unsafe<Curve>(&scalars[0], points.get(), num_points, state);
+        Element result = barretenberg::scalar_multiplication::pippenger_sparse_unsafe<Curve>(
+            &scalars[0], points.get(), num_points, state);
+        EXPECT_EQ(result.normalize(), expected.normalize());
+    };
+
+    // all zero
+    check();
+    // a dense prefix (e.g. the ecc op wires), a sprinkling of ones and random entries in the remainder
+    for (size_t i = 0; i < 300; ++i) {
+        scalars[i] = Fr::random_element();
+    }
+    for (size_t i = 300; i < num_points; i += 37) {
+        scalars[i] = Fr::one();
+    }
+    for (size_t i = 301; i < num_points; i += 101) {
+        scalars[i] = Fr::random_element();
+    }
+    check();
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerBatch)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 8192;
+    // equal sizes are merged into one pippenger run, the others exercise the leftover slices and the Strauss path
+    const std::vector<size_t> msm_sizes = { 2048, 2048, 2048, 2045, 8192, 100, 3, 0 };
+
+    auto points = barretenberg::scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        points.get()[i] = AffineElement(Element::random_element());
+    }
+    barretenberg::scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+
+    std::vector<std::vector<Fr>> scalars;
+    for (const size_t msm_size : msm_sizes) {
+        std::vector<Fr> msm_scalars(msm_size);
+        for (auto& scalar : msm_scalars) {
+            scalar = Fr::random_element();
+        }
+        scalars.emplace_back(std::move(msm_scalars));
+    }
+    // a constant and a half-zero MSM put many points into the same buckets
+    std::fill(scalars[1].begin(), scalars[1].end(), Fr(3));
+    std::fill(scalars[2].begin(), scalars[2].begin() + 1024, Fr::zero());
+
+    std::vector<std::span<const Fr>> scalar_spans(scalars.begin(), scalars.end());
+    barretenberg::scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+    std::vector<Element> results =
+        barretenberg::scalar_multiplication::pippenger_batch_unsafe<Curve>(scalar_spans, points.get(), state);
+
+    EXPECT_EQ(results.size(), msm_sizes.size());
+    for (size_t i = 0; i < msm_sizes.size(); ++i) {
+        Element expected = barretenberg::scalar_multiplication::pippenger_unsafe<Curve>(
+            scalars[i].data(), points.get(), msm_sizes[i], state);
+        EXPECT_EQ(results[i].normalize(), expected.normalize());
+    }
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerTunedBucketWidths)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 1000;
+
+    std::vector<Fr> scalars(num_points);
+    auto points = barretenberg::scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[i] = Fr::random_element();
+        points.get()[i] = AffineElement(Element::random_element());
+    }
+    barretenberg::scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+
+    barretenberg::scalar_multiplication::pippenger_runtime_state<Curve> default_state(num_points);
+    Element expected = barretenberg::scalar_multiplication::pippenger_unsafe<Curve>(
+        &scalars[0], points.get(), num_points, default_state);
+
+    auto& table = barretenberg::scalar_multiplication::get_bucket_width_table<Curve>();
+    const auto original = table;
+    const size_t log_num_points = numeric::get_msb(num_points);
+    for (size_t width : { 2UL, 5UL, 11UL }) {
+        table.widths[log_num_points] = static_cast<uint8_t>(width);
+        barretenberg::scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+        EXPECT_EQ(state.get_bucket_width(num_points), width);
+        Element result =
+            barretenberg::scalar_multiplication::pippenger_unsafe<Curve>(&scalars[0], points.get(), num_points, state);
+        EXPECT_EQ(result.normalize(), expected.normalize());
+
+        // a state sized for the default table falls back to the heuristic when the tuned width does not fit it
+        result = barretenberg::scalar_multiplication::pippenger_unsafe<Curve>(
+            &scalars[0], points.get(), num_points, default_state);
+        EXPECT_EQ(result.normalize(), expected.normalize());
+    }
+    table = original;
+}
+
 TYPED_TEST(ScalarMultiplicationTests, PippengerOne)
 {
     using Curve = TypeParam;
@@ -0,0 +1,499 @@
+#include "file_store.hpp"
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <limits>
+#include <unistd.h>
+
+namespace proof_system::plonk {
+namespace stdlib {
+namespace merkle_tree {
+
+namespace {
+
+/**
+ * The log is the file magic, followed by one record per commit:
+ *
+ *   [payload size: u64][checksum of payload: u64][payload]
+ *
+ * where the payload is a sequence of entries
+ *
+ *   put: [0: u8][key size: u32][key][value size: u32][value]
+ *   del: [1: u8][key size: u32][key]
+ *
+ * Integers are little endian.
+ */
+constexpr std::array<char, 8> FILE_MAGIC = { 'B', 'B', 'S', 'T', 'O', 'R', 'E', '1' };
+constexpr size_t RECORD_HEADER_SIZE = 16;
+constexpr uint8_t OP_PUT = 0;
+constexpr uint8_t OP_DEL = 1;
+// Compaction writes the live entries in records of about this size
+constexpr size_t COMPACTION_RECORD_SIZE = 1 << 22;
+
+uint64_t checksum(uint8_t const* data, size_t size)
+{
+    // FNV-1a, enough to catch a torn write
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= data[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+template <typename T> void write_int(std::vector<uint8_t>& buf, T value)
+{
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        buf.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+template <typename T> T read_int(uint8_t const* data)
+{
+    T value = 0;
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        value |= static_cast<T>(static_cast<T>(data[i]) << (8 * i));
+    }
+    return value;
+}
+
+void write_all(int fd, uint8_t const* data, size_t size, uint64_t offset)
+{
+    while (size > 0) {
+        ssize_t written = pwrite(fd, data, size, static_cast<off_t>(offset));
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            throw_or_abort(std::string("FileStore: write failed: ") + std::strerror(errno));
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+        offset += static_cast<uint64_t>(written);
+    }
+}
+
+// Returns the number of bytes read, which is less than `size` only at the end of the file
+size_t read_all(int fd, uint8_t* data, size_t size, uint64_t offset)
+{
+    size_t total = 0;
+    while (total < size) {
+        ssize_t bytes = pread(fd, data + total, size - total, static_cast<off_t>(offset + total));
+        if (bytes < 0 && errno == EINTR) {
+            continue;
+        }
+        if (bytes < 0) {
+            throw_or_abort(std::string("FileStore: read failed: ") + std::strerror(errno));
+        }
+        if (bytes == 0) {
+            break;
+        }
+        total += static_cast<size_t>(bytes);
+    }
+    return total;
+}
+
+void sync(int fd)
+{
+    if (fsync(fd) != 0) {
+        throw_or_abort(std::string("FileStore: sync failed: ") + std::strerror(errno));
+    }
+}
+
+// Appends a record holding `payload` at `offset`, and syncs it. Returns the offset of the payload.
+uint64_t write_record(int fd, uint64_t offset, std::vector<uint8_t> const& payload)
+{
+    std::vector<uint8_t> header;
+    write_int<uint64_t>(header, payload.size());
+    write_int<uint64_t>(header, checksum(payload.data(), payload.size()));
+    write_all(fd, header.data(), header.size(), offset);
+    write_all(fd, payload.data(), payload.size(), offset + RECORD_HEADER_SIZE);
+    sync(fd);
+    return offset + RECORD_HEADER_SIZE;
+}
+
+int open_file(std::string const& path)
+{
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        throw_or_abort("FileStore: could not open " + path + ": " + std::strerror(errno));
+    }
+    return fd;
+}
+
+void write_magic(int fd)
+{
+    write_all(fd, reinterpret_cast<uint8_t const*>(FILE_MAGIC.data()), FILE_MAGIC.size(), 0);
+    sync(fd);
+}
+
+std::string to_string(std::vector<uint8_t> const& input)
+{
+    return std::string((char*)input.data(), input.size());
+}
+
+} // namespace
+
+FileStore::FileStore(std::string const& path)
+    : path_(path)
+{
+    open_log();
+}
+
+FileStore::~FileStore()
+{
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+}
+
+void FileStore::open_log()
+{
+    fd_ = open_file(path_);
+    std::array<char, FILE_MAGIC.size()> magic{};
+    size_t magic_size = read_all(fd_, reinterpret_cast<uint8_t*>(magic.data()), magic.size(), 0);
+    if (magic_size == 0) {
+        write_magic(fd_);
+    } else if (magic_size != magic.size() || magic != FILE_MAGIC) {
+        throw_or_abort("FileStore: " + path_ + " is not a store file.");
+    }
+    file_size_ = FILE_MAGIC.size();
+    replay_log();
+}
+
+/**
+ * Rebuilds the index from the log. A record that was only partly written, or is corrupt, must be the last one (as
+ * commits are synced one at a time), so the log is cut off there.
+ */
+void FileStore::replay_log()
+{
+    index_.clear();
+    multi_version_keys_.clear();
+    version_ = 0;
+    const off_t end = lseek(fd_, 0, SEEK_END);
+    const uint64_t log_size = end < 0 ? 0 : static_cast<uint64_t>(end);
+    std::vector<uint8_t> payload;
+    while (true) {
+        std::array<uint8_t, RECORD_HEADER_SIZE> header{};
+        if (read_all(fd_, header.data(), header.size(), file_size_) != header.size()) {
+            break;
+        }
+        const uint64_t payload_size = read_int<uint64_t>(header.data());
+        const uint64_t payload_checksum = read_int<uint64_t>(header.data() + 8);
+        const uint64_t payload_offset = file_size_ + RECORD_HEADER_SIZE;
+        if (payload_size > log_size - payload_offset) {
+            break;
+        }
+        payload.resize(payload_size);
+        if (read_all(fd_, payload.data(), payload.size(), payload_offset) != payload.size() ||
+            checksum(payload.data(), payload.size()) != payload_checksum) {
+            break;
+        }
+
+        ++version_;
+        size_t pos = 0;
+        while (pos < payload.size()) {
+            const uint8_t op = payload[pos];
+            const uint32_t key_size = read_int<uint32_t>(&payload[pos + 1]);
+            std::string key((char*)&payload[pos + 5], key_size);
+            pos += 5 + key_size;
+            Version version{ version_, 0, 0, op == OP_DEL };
+            if (op == OP_PUT) {
+                version.size = read_int<uint32_t>(&payload[pos]);
+                version.offset = payload_offset + pos + 4;
+                pos += 4 + version.size;
+            }
+            // No snapshots exist yet, so only the latest version of each key matters
+            if (version.deleted) {
+                index_.erase(key);
+            } else {
+                index_[key] = { version };
+            }
+        }
+        file_size_ = payload_offset + payload_size;
+    }
+
+    // Drop whatever follows the last complete record
+    if (ftruncate(fd_, static_cast<off_t>(file_size_)) != 0) {
+        throw_or_abort(std::string("FileStore: truncate failed: ") + std::strerror(errno));
+    }
+    sync(fd_);
+}
+
+bool FileStore::put(std::vector<uint8_t> const& key, std::vector<uint8_t> const& value)
+{
+    auto key_str = to_string(key);
+    puts_[key_str] = value;
+    deletes_.erase(key_str);
+    return true;
+}
+
+bool FileStore::del(std::vector<uint8_t> const& key)
+{
+    auto key_str = to_string(key);
+    puts_.erase(key_str);
+    deletes_.insert(key_str);
+    return true;
+}
+
+bool FileStore::get(std::vector<uint8_t> const& key, std::vector<uint8_t>& value)
+{
+    auto key_str = to_string(key);
+    if (deletes_.find(key_str) != deletes_.end()) {
+        return false;
+    }
+    auto it = puts_.find(key_str);
+    if (it != puts_.end()) {
+        value = it->second;
+        return true;
+    }
+    return get_committed(key_str, std::numeric_limits<uint64_t>::max(), value);
+}
+
+bool FileStore::get_committed(std::string const& key, uint64_t commit, std::vector<uint8_t>& value) const
+{
+    Version version{};
+    {
+        std::shared_lock<std::shared_mutex> lock(index_mutex_);
+        auto it = index_.find(key);
+        if (it == index_.end()) {
+            return false;
+        }
+        // Versions are in commit order, find the last one at or before `commit`
+        auto const& versions = it->second;
+        auto found = std::upper_bound(
+            versions.begin(), versions.end(), commit, [](uint64_t c, Version const& v) { return c < v.commit; });
+        if (found == versions.begin()) {
+            return false;
+        }
+        version = *std::prev(found);
+    }
+    if (version.deleted) {
+        return false;
+    }
+    // Committed values are never overwritten, so the file can be read without holding the lock. compact() does replace
+    // the file, but only while no snapshot is open, i.e. while no other thread reads.
+    read_value(version, value);
+    return true;
+}
+
+void FileStore::read_value(Version const& version, std::vector<uint8_t>& value) const
+{
+    value.resize(version.size);
+    if (read_all(fd_, value.data(), value.size(), version.offset) != value.size()) {
+        throw_or_abort("FileStore: unexpected end of " + path_);
+    }
+}
+
+void FileStore::commit()
+{
+    if (puts_.empty() && deletes_.empty()) {
+        return;
+    }
+
+    std::vector<uint8_t> payload;
+    std::vector<std::pair<std::string const*, Version>> entries;
+    entries.reserve(puts_.size() + deletes_.size());
+    for (auto const& [key, value] : puts_) {
+        payload.push_back(OP_PUT);
+        write_int<uint32_t>(payload, static_cast<uint32_t>(key.size()));
+        payload.insert(payload.end(), key.begin(), key.end());
+        write_int<uint32_t>(payload, static_cast<uint32_t>(value.size()));
+        entries.push_back({ &key, { 0, payload.size(), static_cast<uint32_t>(value.size()), false } });
+        payload.insert(payload.end(), value.begin(), value.end());
+    }
+    for (auto const& key : deletes_) {
+        payload.push_back(OP_DEL);
+        write_int<uint32_t>(payload, static_cast<uint32_t>(key.size()));
+        payload.insert(payload.end(), key.begin(), key.end());
+        entries.push_back({ &key, { 0, 0, 0, true } });
+    }
+
+    // The commit is durable once the record is synced. Only then do we publish it in the index.
+    const uint64_t payload_offset = write_record(fd_, file_size_, payload);
+    file_size_ = payload_offset + payload.size();
+    {
+        std::unique_lock<std::shared_mutex> lock(index_mutex_);
+        ++version_;
+        for (auto& [key, version] : entries) {
+            version.commit = version_;
+            version.offset += payload_offset;
+            auto& versions = index_[*key];
+            versions.push_back(version);
+            if (versions.size() > 1) {
+                multi_version_keys_.insert(*key);
+            } else if (version.deleted) {
+                // Nothing older to hide, a lone tombstone is the same as no entry
+                index_.erase(*key);
+            }
+        }
+    }
+    puts_.clear();
+    deletes_.clear();
+    prune_versions();
+}
+
+void FileStore::rollback()
+{
+    puts_.clear();
+    deletes_.clear();
+}
+
+/**
+ * Drops the versions that no snapshot can see any more: for every key, all but the last version at or before the
+ * oldest snapshot (or the latest commit, if there are no snapshots).
+ */
+void FileStore::prune_versions()
+{
+    uint64_t oldest_commit = 0;
+    {
+        std::unique_lock<std::mutex> lock(snapshot_mutex_);
+        std::shared_lock<std::shared_mutex> index_lock(index_mutex_);
+        oldest_commit = snapshots_.empty() ? version_ : *snapshots_.begin();
+    }
+    std::unique_lock<std::shared_mutex> lock(index_mutex_);
+    for (auto key_it = multi_version_keys_.begin(); key_it != multi_version_keys_.end();) {
+        auto it = index_.find(*key_it);
+        ASSERT(it != index_.end());
+        auto& versions = it->second;
+        auto visible = std::upper_bound(
+            versions.begin(), versions.end(), oldest_commit, [](uint64_t c, Version const& v) { return c < v.commit; });
+        if (visible != versions.begin()) {
+            versions.erase(versions.begin(), std::prev(visible));
+        }
+        if (versions.size() > 1) {
+            ++key_it;
+            continue;
+        }
+        if (versions[0].deleted) {
+            index_.erase(it);
+        }
+        key_it = multi_version_keys_.erase(key_it);
+    }
+}
+
+FileStoreSnapshot FileStore::snapshot()
+{
+    std::unique_lock<std::mutex> lock(snapshot_mutex_);
+    std::shared_lock<std::shared_mutex> index_lock(index_mutex_);
+    snapshots_.insert(version_);
+    return FileStoreSnapshot(this, version_);
+}
+
+void FileStore::release_snapshot(uint64_t commit)
+{
+    std::unique_lock<std::mutex> lock(snapshot_mutex_);
+    snapshots_.erase(snapshots_.find(commit));
+}
+
+uint64_t FileStore::version() const
+{
+    std::shared_lock<std::shared_mutex> lock(index_mutex_);
+    return version_;
+}
+
+/**
+ * Writes the live entries to a new log next to the current one, then renames it over the current one. A crash before
+ * the rename leaves the current log untouched. The index is locked throughout, as readers use the file descriptor that
+ * is swapped at the end.
+ */
+void FileStore::compact()
+{
+    if (!puts_.empty() || !deletes_.empty()) {
+        throw_or_abort("FileStore: cannot compact with uncommitted writes.");
+    }
+    {
+        std::unique_lock<std::mutex> lock(snapshot_mutex_);
+        if (!snapshots_.empty()) {
+            throw_or_abort("FileStore: cannot compact while snapshots are open.");
+        }
+    }
+
+    // Versions kept for snapshots that have since been released, including tombstones, must not be written out
+    prune_versions();
+
+    std::unique_lock<std::shared_mutex> lock(index_mutex_);
+    const std::string compact_path = path_ + ".compact";
+    int compact_fd = open_file(compact_path);
+    if (ftruncate(compact_fd, 0) != 0) {
+        throw_or_abort(std::string("FileStore: truncate failed: ") + std::strerror(errno));
+    }
+    write_magic(compact_fd);
+    uint64_t compact_size = FILE_MAGIC.size();
+    std::vector<uint8_t> payload;
+    std::vector<uint8_t> value;
+    for (auto const& [key, versions] : index_) {
+        if (versions.back().deleted) {
+            continue;
+        }
+        read_value(versions.back(), value);
+        payload.push_back(OP_PUT);
+        write_int<uint32_t>(payload, static_cast<uint32_t>(key.size()));
+        payload.insert(payload.end(), key.begin(), key.end());
+        write_int<uint32_t>(payload, static_cast<uint32_t>(value.size()));
+        payload.insert(payload.end(), value.begin(), value.end());
+        if (payload.size() >= COMPACTION_RECORD_SIZE) {
+            compact_size = write_record(compact_fd, compact_size, payload) + payload.size();
+            payload.clear();
+        }
+    }
+    if (!payload.empty()) {
+        write_record(compact_fd, compact_size, payload);
+    }
+    ::close(compact_fd);
+
+    if (std::rename(compact_path.c_str(), path_.c_str()) != 0) {
+        throw_or_abort(std::string("FileStore: rename failed: ") + std::strerror(errno));
+    }
+    ::close(fd_);
+
+    const uint64_t version = version_;
+    open_log();
+    version_ = version;
+    for (auto& [key, versions] : index_) {
+        versions[0].commit = version_;
+    }
+}
+
+FileStoreSnapshot::FileStoreSnapshot(FileStore* store, uint64_t commit)
+    : store_(store)
+    , commit_(commit)
+{}
+
+FileStoreSnapshot::FileStoreSnapshot(FileStoreSnapshot&& other)
+    : store_(other.store_)
+    , commit_(other.commit_)
+{
+    other.store_ = nullptr;
+}
+
+FileStoreSnapshot::~FileStoreSnapshot()
+{
+    if (store_ != nullptr) {
+        store_->release_snapshot(commit_);
+    }
+}
+
+bool FileStoreSnapshot::put(std::vector<uint8_t> const& /*unused*/, std::vector<uint8_t> const& /*unused*/)
+{
+    throw_or_abort("FileStoreSnapshot: snapshots are read-only.");
+}
+
+bool FileStoreSnapshot::del(std::vector<uint8_t> const& /*unused*/)
+{
+    throw_or_abort("FileStoreSnapshot: snapshots are read-only.");
+}
+
+bool FileStoreSnapshot::get(std::vector<uint8_t> const& key, std::vector<uint8_t>& value) const
+{
+    return store_->get_committed(to_string(key), commit_, value);
+}
+
+} // namespace merkle_tree
+} // namespace stdlib
+} // namespace proof_system::plonk
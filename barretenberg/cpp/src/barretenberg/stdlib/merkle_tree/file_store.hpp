@@ -0,0 +1,133 @@
+#pragma once
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace proof_system::plonk {
+namespace stdlib {
+namespace merkle_tree {
+
+class FileStoreSnapshot;
+
+/**
+ * A persistent store for MerkleTree, with the same interface as MemoryStore.
+ *
+ * The store is a single append-only log file. Each commit appends one batch record of puts and deletes, followed by a
+ * checksum, and syncs it to disk before returning, so a commit is atomic and durable: after a crash, reopening the
+ * file replays every complete batch and cuts off a torn one. The log is its own write-ahead log, values are never
+ * overwritten in place.
+ *
+ * Only the index (key -> location of the value in the file) lives in memory, values are read from the file on demand.
+ * Every index entry keeps the versions of its key that a live snapshot may still see, so a snapshot is just a commit
+ * number: taking one copies nothing, and readers on other threads can walk the tree as of that commit while the
+ * writer applies the next batch. Older versions are dropped once no snapshot needs them, and compact() rewrites the
+ * file without the dead records.
+ *
+ * Writes (put, del, commit, rollback, compact) must come from a single thread. Uncommitted writes are only visible to
+ * the writer's own get(), like in MemoryStore.
+ */
+class FileStore {
+  public:
+    explicit FileStore(std::string const& path);
+    FileStore(FileStore const& other) = delete;
+    FileStore(FileStore&& other) = delete;
+    ~FileStore();
+
+    FileStore& operator=(FileStore const& other) = delete;
+    FileStore& operator=(FileStore&& other) = delete;
+
+    bool put(std::vector<uint8_t> const& key, std::vector<uint8_t> const& value);
+
+    bool del(std::vector<uint8_t> const& key);
+
+    bool get(std::vector<uint8_t> const& key, std::vector<uint8_t>& value);
+
+    // Appends the pending writes to the log as a single batch, and syncs it to disk
+    void commit();
+
+    void rollback();
+
+    // A read-only view of the store as of the last commit
+    FileStoreSnapshot snapshot();
+
+    // The number of commits in the log
+    uint64_t version() const;
+
+    // Rewrites the log with only the live entries. Requires no pending writes and no open snapshots.
+    void compact();
+
+  private:
+    friend class FileStoreSnapshot;
+
+    struct Version {
+        uint64_t commit;
+        uint64_t offset;
+        uint32_t size;
+        bool deleted;
+    };
+
+    void open_log();
+    void replay_log();
+    uint64_t append_batch(std::vector<uint8_t> const& batch);
+    void read_value(Version const& version, std::vector<uint8_t>& value) const;
+    bool get_committed(std::string const& key, uint64_t commit, std::vector<uint8_t>& value) const;
+    void prune_versions();
+    void release_snapshot(uint64_t commit);
+
+    std::string path_;
+    int fd_ = -1;
+    uint64_t file_size_ = 0;
+
+    // The index, guarded by index_mutex_ as snapshots read it from other threads
+    mutable std::shared_mutex index_mutex_;
+    std::unordered_map<std::string, std::vector<Version>> index_;
+    uint64_t version_ = 0;
+    // Keys with more than one version, to revisit once the snapshots holding on to them are gone
+    std::unordered_set<std::string> multi_version_keys_;
+
+    std::mutex snapshot_mutex_;
+    std::multiset<uint64_t> snapshots_;
+
+    std::map<std::string, std::vector<uint8_t>> puts_;
+    std::set<std::string> deletes_;
+};
+
+/**
+ * A read-only view of a FileStore as of one commit. It can be used as the store of a MerkleTree from any thread, to
+ * read the roots, hash paths and sibling paths of that commit. It must not outlive the FileStore it came from.
+ */
+class FileStoreSnapshot {
+  public:
+    FileStoreSnapshot(FileStoreSnapshot const& other) = delete;
+    FileStoreSnapshot(FileStoreSnapshot&& other);
+    ~FileStoreSnapshot();
+
+    FileStoreSnapshot& operator=(FileStoreSnapshot const& other) = delete;
+    FileStoreSnapshot& operator=(FileStoreSnapshot&& other) = delete;
+
+    bool put(std::vector<uint8_t> const& key, std::vector<uint8_t> const& value);
+
+    bool del(std::vector<uint8_t> const& key);
+
+    bool get(std::vector<uint8_t> const& key, std::vector<uint8_t>& value) const;
+
+    uint64_t version() const { return commit_; }
+
+  private:
+    friend class FileStore;
+
+    FileStoreSnapshot(FileStore* store, uint64_t commit);
+
+    FileStore* store_;
+    uint64_t commit_;
+};
+
+} // namespace merkle_tree
+} // namespace stdlib
+} // namespace proof_system::plonk
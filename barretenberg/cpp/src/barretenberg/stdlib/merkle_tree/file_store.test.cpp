@@ -0,0 +1,216 @@
+#include "file_store.hpp"
+#include "barretenberg/common/test.hpp"
+#include "memory_store.hpp"
+#include "memory_tree.hpp"
+#include "merkle_tree.hpp"
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
+namespace proof_system::test_stdlib_merkle_tree_file_store {
+
+using namespace proof_system::plonk::stdlib::merkle_tree;
+
+namespace {
+// Removes the store's file before and after each test
+class ScopedPath {
+  public:
+    ScopedPath(std::string path)
+        : path(std::move(path))
+    {
+        std::remove(this->path.c_str());
+    }
+    ~ScopedPath()
+    {
+        std::remove(path.c_str());
+        std::remove((path + ".compact").c_str());
+    }
+    std::string path;
+};
+
+std::vector<uint8_t> bytes(std::string const& str)
+{
+    return { str.begin(), str.end() };
+}
+} // namespace
+
+TEST(stdlib_merkle_tree_file_store, put_get_commit_rollback)
+{
+    ScopedPath file("file_store_put_get.log");
+    FileStore store(file.path);
+    std::vector<uint8_t> value;
+
+    store.put(bytes("a"), bytes("1"));
+    EXPECT_TRUE(store.get(bytes("a"), value));
+    EXPECT_EQ(value, bytes("1"));
+    store.rollback();
+    EXPECT_FALSE(store.get(bytes("a"), value));
+
+    store.put(bytes("a"), bytes("1"));
+    store.put(bytes("b"), bytes("2"));
+    store.commit();
+    store.del(bytes("a"));
+    EXPECT_FALSE(store.get(bytes("a"), value));
+    store.rollback();
+    EXPECT_TRUE(store.get(bytes("a"), value));
+    EXPECT_EQ(value, bytes("1"));
+
+    store.del(bytes("a"));
+    store.put(bytes("b"), bytes("3"));
+    store.commit();
+    EXPECT_FALSE(store.get(bytes("a"), value));
+    EXPECT_TRUE(store.get(bytes("b"), value));
+    EXPECT_EQ(value, bytes("3"));
+    EXPECT_EQ(store.version(), 2U);
+}
+
+TEST(stdlib_merkle_tree_file_store, tree_survives_reopen)
+{
+    constexpr size_t depth = 8;
+    ScopedPath file("file_store_reopen.log");
+    MemoryTree memdb(depth);
+    {
+        FileStore store(file.path);
+        MerkleTree db(store, depth);
+        for (size_t i = 0; i < 64; ++i) {
+            memdb.update_element(i * 3, fr(i + 1));
+            db.update_element(i * 3, fr(i + 1));
+            if (i % 8 == 7) {
+                store.commit();
+            }
+        }
+        // Never committed, so lost on reopening
+        db.update_element(200, fr(1000));
+    }
+
+    FileStore store(file.path);
+    MerkleTree db(store, depth);
+    EXPECT_EQ(store.version(), 8U);
+    EXPECT_EQ(db.root(), memdb.root());
+    EXPECT_EQ(db.size(), 190U);
+    for (size_t i = 0; i < 64; ++i) {
+        EXPECT_EQ(db.get_hash_path(i * 3), memdb.get_hash_path(i * 3));
+    }
+
+    // Compaction keeps the contents, and the store stays usable
+    fr root = db.root();
+    store.compact();
+    EXPECT_EQ(db.root(), root);
+    memdb.update_element(5, fr(77));
+    db.update_element(5, fr(77));
+    store.commit();
+    EXPECT_EQ(db.get_sibling_path(5), memdb.get_sibling_path(5));
+    EXPECT_EQ(db.root(), memdb.root());
+}
+
+// A key deleted while a snapshot held on to it stays deleted through compaction
+TEST(stdlib_merkle_tree_file_store, compact_drops_deleted_keys)
+{
+    ScopedPath file("file_store_compact_deleted.log");
+    std::vector<uint8_t> value;
+    {
+        FileStore store(file.path);
+        store.put(bytes("a"), bytes("1"));
+        store.put(bytes("b"), bytes("2"));
+        store.commit();
+        {
+            FileStoreSnapshot snapshot = store.snapshot();
+            store.del(bytes("a"));
+            store.commit();
+            EXPECT_TRUE(snapshot.get(bytes("a"), value));
+        }
+        EXPECT_FALSE(store.get(bytes("a"), value));
+        store.compact();
+        EXPECT_FALSE(store.get(bytes("a"), value));
+        EXPECT_TRUE(store.get(bytes("b"), value));
+        EXPECT_EQ(value, bytes("2"));
+    }
+    FileStore store(file.path);
+    EXPECT_FALSE(store.get(bytes("a"), value));
+    EXPECT_TRUE(store.get(bytes("b"), value));
+    EXPECT_EQ(value, bytes("2"));
+}
+
+TEST(stdlib_merkle_tree_file_store, torn_commit_is_discarded)
+{
+    ScopedPath file("file_store_torn.log");
+    std::vector<uint8_t> value;
+    size_t committed_size = 0;
+    {
+        FileStore store(file.path);
+        store.put(bytes("a"), bytes("1"));
+        store.commit();
+        std::ifstream in(file.path, std::ios::binary | std::ios::ate);
+        committed_size = static_cast<size_t>(in.tellg());
+        store.put(bytes("a"), bytes("2"));
+        store.put(bytes("b"), bytes("3"));
+        store.commit();
+    }
+    {
+        // Chop the second record in half, as if we had crashed while writing it
+        std::ifstream in(file.path, std::ios::binary);
+        std::vector<char> contents((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        contents.resize(committed_size + (contents.size() - committed_size) / 2);
+        std::ofstream out(file.path, std::ios::binary | std::ios::trunc);
+        out.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+    }
+    {
+        FileStore store(file.path);
+        EXPECT_EQ(store.version(), 1U);
+        EXPECT_TRUE(store.get(bytes("a"), value));
+        EXPECT_EQ(value, bytes("1"));
+        EXPECT_FALSE(store.get(bytes("b"), value));
+
+        // New commits go after the last complete one
+        store.put(bytes("b"), bytes("4"));
+        store.commit();
+    }
+    FileStore store(file.path);
+    EXPECT_EQ(store.version(), 2U);
+    EXPECT_TRUE(store.get(bytes("b"), value));
+    EXPECT_EQ(value, bytes("4"));
+}
+
+TEST(stdlib_merkle_tree_file_store, snapshot_reads_while_writing)
+{
+    constexpr size_t depth = 10;
+    ScopedPath file("file_store_snapshot.log");
+    FileStore store(file.path);
+    MerkleTree db(store, depth);
+    MemoryTree memdb(depth);
+    for (size_t i = 0; i < 32; ++i) {
+        memdb.update_element(i, fr(i));
+        db.update_element(i, fr(i));
+    }
+    store.commit();
+
+    auto snapshot = store.snapshot();
+    MerkleTree snapshot_db(snapshot, depth);
+    const fr root = memdb.root();
+    std::vector<fr_sibling_path> paths;
+    for (size_t i = 0; i < 32; ++i) {
+        paths.push_back(memdb.get_sibling_path(i));
+    }
+
+    // A reader walks the snapshot while the writer commits more blocks, which also removes nodes the snapshot uses
+    std::thread reader([&]() {
+        for (size_t round = 0; round < 4; ++round) {
+            EXPECT_EQ(snapshot_db.root(), root);
+            for (size_t i = 0; i < 32; ++i) {
+                EXPECT_EQ(snapshot_db.get_sibling_path(i), paths[i]);
+            }
+        }
+    });
+    for (size_t i = 0; i < 32; ++i) {
+        memdb.update_element(i, fr(i + 100));
+        db.update_element(i, fr(i + 100));
+        store.commit();
+    }
+    reader.join();
+
+    EXPECT_EQ(snapshot_db.root(), root);
+    EXPECT_EQ(db.root(), memdb.root());
+    EXPECT_EQ(store.snapshot().version(), store.version());
+}
+
+} // namespace proof_system::test_stdlib_merkle_tree_file_store
@@ -1,18 +1,27 @@
 #pragma once
 #include "barretenberg/common/net.hpp"
+#include "barretenberg/common/thread_utils.hpp"
 #include "barretenberg/crypto/blake2s/blake2s.hpp"
 #include "barretenberg/crypto/pedersen_commitment/pedersen.hpp"
 #include "barretenberg/crypto/pedersen_hash/pedersen.hpp"
+#include "barretenberg/crypto/poseidon2/poseidon2.hpp"
 #include "barretenberg/stdlib/hash/blake2s/blake2s.hpp"
 #include "barretenberg/stdlib/hash/pedersen/pedersen.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
+#include <algorithm>
+#include <array>
+#include <span>
 #include <vector>
 
 namespace proof_system::plonk::stdlib::merkle_tree {
 
 inline barretenberg::fr hash_pair_native(barretenberg::fr const& lhs, barretenberg::fr const& rhs)
 {
-    return crypto::pedersen_hash::hash({ lhs, rhs }); // uses lookup tables
+    // A stack array of inputs, and a context that is built once (its domain separator is a heap allocated string), keep
+    // the hash free of heap allocations
+    static const crypto::pedersen_hash::GeneratorContext context;
+    const std::array<barretenberg::fr, 2> inputs{ lhs, rhs };
+    return crypto::pedersen_hash::hash(std::span<const barretenberg::fr>(inputs), context);
 }
 
 inline barretenberg::fr hash_native(std::vector<barretenberg::fr> const& inputs)
@@ -21,46 +30,138 @@ inline barretenberg::fr hash_native(std::vector<barretenberg::fr> const& inputs)
 }
 
 /**
- * Computes the root of a tree with leaves given as the vector `input`.
- *
- * @param input: vector of leaf values.
- * @returns root as field
+ * The hash of the merkle trees: MemoryTree, MerkleTree and the nullifier trees are parameterised over a hashing policy,
+ * which provides
+ *  - hash(inputs): the hash of a leaf's preimage,
+ *  - hash_pair(lhs, rhs): the hash of two sibling nodes,
+ *  - hash_pairs(nodes, parents): parents[i] = hash_pair(nodes[2i], nodes[2i+1]), i.e. a layer (or part of one).
  */
-inline barretenberg::fr compute_tree_root_native(std::vector<barretenberg::fr> const& input)
-{
-    // Check if the input vector size is a power of 2.
-    ASSERT(input.size() > 0);
-    ASSERT(numeric::is_power_of_two(input.size()));
-    auto layer = input;
-    while (layer.size() > 1) {
-        std::vector<barretenberg::fr> next_layer(layer.size() / 2);
-        for (size_t i = 0; i < next_layer.size(); ++i) {
-            next_layer[i] = crypto::pedersen_hash::hash({ layer[i * 2], layer[i * 2 + 1] });
+struct PedersenHashPolicy {
+    static barretenberg::fr hash(std::vector<barretenberg::fr> const& inputs) { return hash_native(inputs); }
+
+    static barretenberg::fr hash_pair(barretenberg::fr const& lhs, barretenberg::fr const& rhs)
+    {
+        return hash_pair_native(lhs, rhs);
+    }
+
+    static void hash_pairs(std::span<const barretenberg::fr> nodes, std::span<barretenberg::fr> parents)
+    {
+        for (size_t i = 0; i < parents.size(); ++i) {
+            parents[i] = hash_pair_native(nodes[i * 2], nodes[i * 2 + 1]);
         }
-        layer = std::move(next_layer);
     }
+};
 
-    return layer[0];
+/**
+ * Hashes with Poseidon2 (over bn254's scalar field), as Poseidon2::hash does: a pair is compressed with one permutation
+ * of the sponge state (lhs, rhs, 0, iv). hash_pairs runs the permutations of many pairs side by side with
+ * Poseidon2Permutation::permutation_batch.
+ */
+struct Poseidon2HashPolicy {
+    using Params = crypto::Poseidon2Bn254ScalarFieldParams;
+    using Permutation = crypto::Poseidon2Permutation<Params>;
+
+    // The sponge's domain separator for a fixed length input of 2 elements and 1 output
+    static inline const barretenberg::fr PAIR_IV = barretenberg::fr(uint256_t(2) << 64);
+
+    static barretenberg::fr hash(std::vector<barretenberg::fr> const& inputs)
+    {
+        std::vector<barretenberg::fr> input_copy(inputs);
+        return crypto::Poseidon2<Params>::hash(input_copy);
+    }
+
+    static barretenberg::fr hash_pair(barretenberg::fr const& lhs, barretenberg::fr const& rhs)
+    {
+        return Permutation::permutation({ lhs, rhs, 0, PAIR_IV })[0];
+    }
+
+    static void hash_pairs(std::span<const barretenberg::fr> nodes, std::span<barretenberg::fr> parents)
+    {
+        // Permute a few batches' worth of states at a time, so the states stay in cache
+        constexpr size_t CHUNK_SIZE = Permutation::BATCH_LANES * 8;
+        std::array<Permutation::State, CHUNK_SIZE> states;
+        for (size_t chunk = 0; chunk < parents.size(); chunk += CHUNK_SIZE) {
+            const size_t chunk_size = std::min(CHUNK_SIZE, parents.size() - chunk);
+            for (size_t i = 0; i < chunk_size; ++i) {
+                states[i] = { nodes[(chunk + i) * 2], nodes[(chunk + i) * 2 + 1], 0, PAIR_IV };
+            }
+            Permutation::permutation_batch(std::span<Permutation::State>(states.data(), chunk_size));
+            for (size_t i = 0; i < chunk_size; ++i) {
+                parents[chunk + i] = states[i][0];
+            }
+        }
+    }
+};
+
+/**
+ * Minimum number of pair hashes per thread when hashing a layer. A native pedersen hash costs tens of microseconds, so
+ * even small layers are worth splitting up.
+ */
+constexpr size_t MIN_HASHES_PER_THREAD = 4;
+
+/**
+ * Hashes the pairs of nodes of `layer` into the parent layer `parents`, i.e. parents[i] = H(layer[2i], layer[2i+1]).
+ * Large layers are hashed in parallel, each thread passing its range to HashingPolicy::hash_pairs.
+ */
+template <typename HashingPolicy = PedersenHashPolicy>
+inline void hash_layer_native(std::span<const barretenberg::fr> layer, std::span<barretenberg::fr> parents)
+{
+    ASSERT(layer.size() == parents.size() * 2);
+    const size_t num_threads = barretenberg::thread_utils::calculate_num_threads(parents.size(), MIN_HASHES_PER_THREAD);
+    const size_t range_per_thread = parents.size() / num_threads;
+    const size_t leftovers = parents.size() - (range_per_thread * num_threads);
+    parallel_for(num_threads, [&](size_t j) {
+        const size_t offset = j * range_per_thread;
+        const size_t size = (j == num_threads - 1) ? range_per_thread + leftovers : range_per_thread;
+        HashingPolicy::hash_pairs(layer.subspan(offset * 2, size * 2), parents.subspan(offset, size));
+    });
 }
 
-// TODO write test
+/**
+ * Computes all the nodes of a tree with leaves given as the vector `input`, layer by layer from the leaves up. Each
+ * layer is hashed in parallel.
+ *
+ * @param input: vector of leaf values, its size must be a power of 2.
+ * @returns the leaves, followed by each layer of the tree in turn, ending with the root.
+ */
+template <typename HashingPolicy = PedersenHashPolicy>
 inline std::vector<barretenberg::fr> compute_tree_native(std::vector<barretenberg::fr> const& input)
 {
     // Check if the input vector size is a power of 2.
     ASSERT(input.size() > 0);
     ASSERT(numeric::is_power_of_two(input.size()));
-    auto layer = input;
-    std::vector<barretenberg::fr> tree(input);
-    while (layer.size() > 1) {
-        std::vector<barretenberg::fr> next_layer(layer.size() / 2);
-        for (size_t i = 0; i < next_layer.size(); ++i) {
-            next_layer[i] = crypto::pedersen_hash::hash({ layer[i * 2], layer[i * 2 + 1] });
-            tree.push_back(next_layer[i]);
-        }
-        layer = std::move(next_layer);
+    std::vector<barretenberg::fr> tree(input.size() * 2 - 1);
+    std::copy(input.begin(), input.end(), tree.begin());
+    size_t offset = 0;
+    for (size_t layer_size = input.size(); layer_size > 1; layer_size /= 2) {
+        hash_layer_native<HashingPolicy>(std::span<const barretenberg::fr>(&tree[offset], layer_size),
+                                         std::span<barretenberg::fr>(&tree[offset + layer_size], layer_size / 2));
+        offset += layer_size;
     }
 
     return tree;
 }
 
+/**
+ * Computes the root of a tree with leaves given as the vector `input`. Each layer overwrites the front half of the one
+ * below it, so only a copy of the leaves is kept rather than every node of the tree.
+ *
+ * @param input: vector of leaf values, its size must be a power of 2.
+ * @returns root as field
+ */
+template <typename HashingPolicy = PedersenHashPolicy>
+inline barretenberg::fr compute_tree_root_native(std::vector<barretenberg::fr> const& input)
+{
+    ASSERT(input.size() > 0);
+    ASSERT(numeric::is_power_of_two(input.size()));
+    std::vector<barretenberg::fr> layer(input);
+    std::vector<barretenberg::fr> parents(input.size() / 2);
+    for (size_t layer_size = input.size(); layer_size > 1; layer_size /= 2) {
+        hash_layer_native<HashingPolicy>(std::span<const barretenberg::fr>(layer.data(), layer_size),
+                                         std::span<barretenberg::fr>(parents.data(), layer_size / 2));
+        std::swap(layer, parents);
+    }
+    return layer[0];
+}
+
 } // namespace proof_system::plonk::stdlib::merkle_tree
@@ -64,4 +64,68 @@ TEST(stdlib_merkle_tree_hash, compute_tree_native)
     }
     EXPECT_EQ(tree_vector.back(), mem_tree.root());
 }
+
+TEST(stdlib_merkle_tree_hash, compute_tree_native_large)
+{
+    // Large enough for the layers to be hashed in parallel
+    constexpr size_t depth = 7;
+    merkle_tree::MemoryTree mem_tree(depth);
+
+    std::vector<fr> leaves;
+    for (size_t i = 0; i < (size_t(1) << depth); i++) {
+        auto input = fr::random_element();
+        leaves.push_back(input);
+        mem_tree.update_element(i, input);
+    }
+
+    std::vector<fr> tree_vector = merkle_tree::compute_tree_native(leaves);
+    ASSERT_EQ(tree_vector.size(), mem_tree.hashes_.size() + 1);
+    for (size_t i = 0; i < tree_vector.size() - 1; i++) {
+        EXPECT_EQ(tree_vector[i], mem_tree.hashes_[i]);
+    }
+    EXPECT_EQ(tree_vector.back(), mem_tree.root());
+    EXPECT_EQ(merkle_tree::compute_tree_root_native(leaves), mem_tree.root());
+}
+
+TEST(stdlib_merkle_tree_hash, poseidon2_hash_pairs)
+{
+    using Policy = merkle_tree::Poseidon2HashPolicy;
+    // Not a multiple of the permutation's batch size
+    constexpr size_t num_pairs = 100;
+    std::vector<fr> nodes;
+    for (size_t i = 0; i < num_pairs * 2; i++) {
+        nodes.push_back(fr::random_element());
+    }
+
+    std::vector<fr> pair{ nodes[0], nodes[1] };
+    EXPECT_EQ(Policy::hash_pair(nodes[0], nodes[1]), crypto::Poseidon2<Policy::Params>::hash(pair));
+
+    std::vector<fr> parents(num_pairs);
+    Policy::hash_pairs(nodes, parents);
+    for (size_t i = 0; i < num_pairs; i++) {
+        EXPECT_EQ(parents[i], Policy::hash_pair(nodes[i * 2], nodes[i * 2 + 1]));
+    }
+}
+
+TEST(stdlib_merkle_tree_hash, compute_tree_native_poseidon2)
+{
+    using Policy = merkle_tree::Poseidon2HashPolicy;
+    constexpr size_t depth = 7;
+    merkle_tree::MemoryTree_<Policy> mem_tree(depth);
+
+    std::vector<fr> leaves;
+    for (size_t i = 0; i < (size_t(1) << depth); i++) {
+        auto input = fr::random_element();
+        leaves.push_back(input);
+        mem_tree.update_element(i, input);
+    }
+
+    std::vector<fr> tree_vector = merkle_tree::compute_tree_native<Policy>(leaves);
+    ASSERT_EQ(tree_vector.size(), mem_tree.hashes_.size() + 1);
+    for (size_t i = 0; i < tree_vector.size() - 1; i++) {
+        EXPECT_EQ(tree_vector[i], mem_tree.hashes_[i]);
+    }
+    EXPECT_EQ(tree_vector.back(), mem_tree.root());
+    EXPECT_NE(merkle_tree::compute_tree_root_native(leaves), mem_tree.root());
+}
 } // namespace proof_system::stdlib_merkle_tree_hash_test
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "hash_path.hpp"
 #include <map>
 #include <set>
+#include <string_view>
 
 namespace proof_system::plonk {
 namespace stdlib {
@@ -38,22 +39,22 @@ class MemoryStore {
         return true;
     };
 
-    bool get(std::vector<uint8_t> const& key, std::vector<uint8_t>& value) { return get(to_string(key), value); }
+    bool get(std::vector<uint8_t> const& key, std::vector<uint8_t>& value) { return get(to_string_view(key), value); }
 
-    bool get(std::string const& key, std::vector<uint8_t>& value)
+    // Looks up `key` without copying it, and reuses the memory of `value`
+    bool get(std::string_view key, std::vector<uint8_t>& value)
     {
         if (deletes_.find(key) != deletes_.end()) {
             return false;
         }
         auto it = puts_.find(key);
         if (it != puts_.end()) {
-            value = std::vector<uint8_t>(it->second.begin(), it->second.end());
+            value.assign(it->second.begin(), it->second.end());
             return true;
         } else {
-            std::string result;
             auto it = store_.find(key);
             if (it != store_.end()) {
-                value = { it->second.begin(), it->second.end() };
+                value.assign(it->second.begin(), it->second.end());
                 return true;
             }
             return false;
@@ -62,8 +63,8 @@ class MemoryStore {
 
     void commit()
     {
-        for (auto it : puts_) {
-            store_.insert(it);
+        for (auto& it : puts_) {
+            store_.insert_or_assign(it.first, std::move(it.second));
         }
         for (auto key : deletes_) {
             store_.erase(key);
@@ -81,9 +82,15 @@ class MemoryStore {
   private:
     std::string to_string(std::vector<uint8_t> const& input) { return std::string((char*)input.data(), input.size()); }
 
-    std::map<std::string, std::string> store_;
-    std::map<std::string, std::string> puts_;
-    std::set<std::string> deletes_;
+    std::string_view to_string_view(std::vector<uint8_t> const& input)
+    {
+        return std::string_view((char const*)input.data(), input.size());
+    }
+
+    // std::less<> allows lookups by string_view
+    std::map<std::string, std::string, std::less<>> store_;
+    std::map<std::string, std::string, std::less<>> puts_;
+    std::set<std::string, std::less<>> deletes_;
 };
 
 } // namespace merkle_tree
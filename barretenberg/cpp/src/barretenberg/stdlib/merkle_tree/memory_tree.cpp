@@ -1,11 +1,11 @@
 #include "memory_tree.hpp"
-#include "hash.hpp"
+#include <algorithm>
 
 namespace proof_system::plonk {
 namespace stdlib {
 namespace merkle_tree {
 
-MemoryTree::MemoryTree(size_t depth)
+template <typename HashingPolicy> MemoryTree_<HashingPolicy>::MemoryTree_(size_t depth)
     : depth_(depth)
 {
 
@@ -20,13 +20,13 @@ MemoryTree::MemoryTree(size_t depth)
         for (size_t i = 0; i < layer_size; ++i) {
             hashes_[offset + i] = current;
         }
-        current = hash_pair_native(current, current);
+        current = HashingPolicy::hash_pair(current, current);
     }
 
     root_ = current;
 }
 
-fr_hash_path MemoryTree::get_hash_path(size_t index)
+template <typename HashingPolicy> fr_hash_path MemoryTree_<HashingPolicy>::get_hash_path(size_t index)
 {
     fr_hash_path path(depth_);
     size_t offset = 0;
@@ -41,7 +41,7 @@ fr_hash_path MemoryTree::get_hash_path(size_t index)
     return path;
 }
 
-fr_sibling_path MemoryTree::get_sibling_path(size_t index)
+template <typename HashingPolicy> fr_sibling_path MemoryTree_<HashingPolicy>::get_sibling_path(size_t index)
 {
     fr_sibling_path path(depth_);
     size_t offset = 0;
@@ -59,7 +59,7 @@ fr_sibling_path MemoryTree::get_sibling_path(size_t index)
     return path;
 }
 
-fr MemoryTree::update_element(size_t index, fr const& value)
+template <typename HashingPolicy> fr MemoryTree_<HashingPolicy>::update_element(size_t index, fr const& value)
 {
     size_t offset = 0;
     size_t layer_size = total_size_;
@@ -67,7 +67,7 @@ fr MemoryTree::update_element(size_t index, fr const& value)
     for (size_t i = 0; i < depth_; ++i) {
         hashes_[offset + index] = current;
         index &= (~0ULL) - 1;
-        current = hash_pair_native(hashes_[offset + index], hashes_[offset + index + 1]);
+        current = HashingPolicy::hash_pair(hashes_[offset + index], hashes_[offset + index + 1]);
         offset += layer_size;
         layer_size >>= 1;
         index >>= 1;
@@ -76,6 +76,57 @@ fr MemoryTree::update_element(size_t index, fr const& value)
     return root_;
 }
 
+template <typename HashingPolicy>
+fr MemoryTree_<HashingPolicy>::update_elements(std::span<const std::pair<size_t, fr>> updates)
+{
+    if (updates.empty()) {
+        return root_;
+    }
+    std::vector<size_t> indices;
+    indices.reserve(updates.size());
+    for (auto const& [index, value] : updates) {
+        ASSERT(index < total_size_);
+        hashes_[index] = value;
+        indices.push_back(index >> 1);
+    }
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+
+    // Walk up the tree a layer at a time. `indices` holds the (sorted, distinct) nodes of the next layer up whose
+    // children have changed, so an ancestor shared by many updated leaves is only rehashed once.
+    // The children of the changed nodes are gathered into one contiguous span, to be hashed as a layer of their own
+    std::vector<fr> children;
+    std::vector<fr> parent_hashes;
+    size_t offset = 0;
+    size_t layer_size = total_size_;
+    for (size_t i = 0; i < depth_; ++i) {
+        children.resize(indices.size() * 2);
+        parent_hashes.resize(indices.size());
+        for (size_t k = 0; k < indices.size(); ++k) {
+            const size_t child = offset + indices[k] * 2;
+            children[k * 2] = hashes_[child];
+            children[k * 2 + 1] = hashes_[child + 1];
+        }
+        hash_layer_native<HashingPolicy>(children, parent_hashes);
+        offset += layer_size;
+        layer_size >>= 1;
+        if (i == depth_ - 1) {
+            // the root is not stored in hashes_
+            root_ = parent_hashes[0];
+            break;
+        }
+        for (size_t k = 0; k < indices.size(); ++k) {
+            hashes_[offset + indices[k]] = parent_hashes[k];
+            indices[k] >>= 1;
+        }
+        indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+    }
+    return root_;
+}
+
+template class MemoryTree_<PedersenHashPolicy>;
+template class MemoryTree_<Poseidon2HashPolicy>;
+
 } // namespace merkle_tree
 } // namespace stdlib
 } // namespace proof_system::plonk
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
+#include "hash.hpp"
 #include "hash_path.hpp"
+#include <span>
 
 namespace proof_system::plonk {
 namespace stdlib {
@@ -22,11 +24,11 @@ using namespace barretenberg;
  *
  * Here, depth_ = 3 and {h_{0,j}}_{i=0..7} are leaf values.
  * Also, root_ = h_{3,0} and total_size_ = (2 * 8 - 2) = 14.
- * Lastly, h_{i,j} = hash( h_{i-1,2j}, h_{i-1,2j+1} ) where i > 1.
+ * Lastly, h_{i,j} = hash( h_{i-1,2j}, h_{i-1,2j+1} ) where i > 1, with the hash of HashingPolicy (see hash.hpp).
  */
-class MemoryTree {
+template <typename HashingPolicy> class MemoryTree_ {
   public:
-    MemoryTree(size_t depth);
+    MemoryTree_(size_t depth);
 
     fr_hash_path get_hash_path(size_t index);
 
@@ -34,6 +36,13 @@ class MemoryTree {
 
     fr update_element(size_t index, fr const& value);
 
+    /**
+     * Sets the leaves at the given indices to the given values, with the same result as calling update_element on
+     * each (index, value) pair in turn. Each affected node is hashed once however many of its leaves change, and
+     * the nodes of a layer are hashed in parallel.
+     */
+    fr update_elements(std::span<const std::pair<size_t, fr>> updates);
+
     fr root() const { return root_; }
 
   public:
@@ -43,6 +52,11 @@ class MemoryTree {
     std::vector<barretenberg::fr> hashes_;
 };
 
+extern template class MemoryTree_<PedersenHashPolicy>;
+extern template class MemoryTree_<Poseidon2HashPolicy>;
+
+using MemoryTree = MemoryTree_<PedersenHashPolicy>;
+
 } // namespace merkle_tree
 } // namespace stdlib
 } // namespace proof_system::plonk
\ No newline at end of file
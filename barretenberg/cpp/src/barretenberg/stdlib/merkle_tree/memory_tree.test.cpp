@@ -78,3 +78,36 @@ TEST(stdlib_merkle_tree, test_memory_store_sibling_path)
     EXPECT_EQ(db.get_sibling_path(3), expected03);
     EXPECT_EQ(db.root(), root);
 }
+
+TEST(stdlib_merkle_tree, test_memory_store_update_elements)
+{
+    constexpr size_t depth = 6;
+    MemoryTree batch_db(depth);
+    MemoryTree sequential_db(depth);
+
+    // A mix of clustered leaves (sharing most of their ancestors), scattered leaves and repeated indices
+    std::vector<std::pair<size_t, fr>> updates;
+    for (size_t i = 0; i < 8; ++i) {
+        updates.emplace_back(i, fr::random_element());
+    }
+    for (size_t i = 8; i < 64; i += 11) {
+        updates.emplace_back(i, fr::random_element());
+    }
+    updates.emplace_back(3, fr::random_element());
+    updates.emplace_back(63, fr::random_element());
+
+    for (auto const& [index, value] : updates) {
+        sequential_db.update_element(index, value);
+    }
+    EXPECT_EQ(batch_db.update_elements(updates), sequential_db.root());
+    EXPECT_EQ(batch_db.hashes_, sequential_db.hashes_);
+
+    // A second batch on top of the first
+    updates = { { 62, fr::random_element() }, { 1, fr::random_element() } };
+    for (auto const& [index, value] : updates) {
+        sequential_db.update_element(index, value);
+    }
+    EXPECT_EQ(batch_db.update_elements(updates), sequential_db.root());
+    EXPECT_EQ(batch_db.hashes_, sequential_db.hashes_);
+    EXPECT_EQ(batch_db.update_elements({}), sequential_db.root());
+}
@@ -71,4 +71,18 @@ void update_random_elements(State& state) noexcept
 }
 BENCHMARK(update_random_elements)->Unit(benchmark::kMillisecond)->Range(100, 100)->Iterations(1);
 
+void get_hash_paths(State& state) noexcept
+{
+    MemoryStore store;
+    MerkleTree db(store, DEPTH);
+    for (size_t i = 0; i < MAX; ++i) {
+        db.update_element(i, VALUES[i]);
+    }
+    size_t i = 0;
+    for (auto _ : state) {
+        DoNotOptimize(db.get_hash_path(i++ % MAX));
+    }
+}
+BENCHMARK(get_hash_paths)->Unit(benchmark::kMicrosecond);
+
 BENCHMARK_MAIN();
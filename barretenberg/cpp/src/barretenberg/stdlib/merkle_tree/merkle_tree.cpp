@@ -3,6 +3,7 @@
 #include "barretenberg/numeric/bitop/count_leading_zeros.hpp"
 #include "barretenberg/numeric/bitop/keep_n_lsb.hpp"
 #include "barretenberg/numeric/uint128/uint128.hpp"
+#include "file_store.hpp"
 #include "hash.hpp"
 #include "memory_store.hpp"
 #include <iostream>
@@ -14,20 +15,18 @@ namespace merkle_tree {
 
 using namespace barretenberg;
 
-// Size of merkle tree nodes in bytes.
-constexpr size_t REGULAR_NODE_SIZE = 64;
-constexpr size_t STUMP_NODE_SIZE = 65;
-
 template <typename T> inline bool bit_set(T const& index, size_t i)
 {
     return bool((index >> i) & 0x1);
 }
 
-template <typename Store>
-MerkleTree<Store>::MerkleTree(Store& store, size_t depth, uint8_t tree_id)
+template <typename Store, typename HashingPolicy>
+MerkleTree<Store, HashingPolicy>::MerkleTree(Store& store, size_t depth, uint8_t tree_id, size_t node_cache_slots)
     : store_(store)
     , depth_(depth)
     , tree_id_(tree_id)
+    , node_cache_(node_cache_slots)
+    , key_buf_(sizeof(fr))
 {
     ASSERT(depth_ >= 1 && depth <= 256);
     zero_hashes_.resize(depth);
@@ -36,29 +35,33 @@ MerkleTree<Store>::MerkleTree(Store& store, size_t depth, uint8_t tree_id)
     auto current = fr(0);
     for (size_t i = 0; i < depth; ++i) {
         zero_hashes_[i] = current;
-        current = hash_pair_native(current, current);
+        current = HashingPolicy::hash_pair(current, current);
     }
 }
 
-template <typename Store>
-MerkleTree<Store>::MerkleTree(MerkleTree&& other)
+template <typename Store, typename HashingPolicy>
+MerkleTree<Store, HashingPolicy>::MerkleTree(MerkleTree&& other)
     : store_(other.store_)
     , zero_hashes_(std::move(other.zero_hashes_))
     , depth_(other.depth_)
     , tree_id_(other.tree_id_)
+    , node_cache_(std::move(other.node_cache_))
+    , key_buf_(std::move(other.key_buf_))
+    , value_buf_(std::move(other.value_buf_))
 {}
 
-template <typename Store> MerkleTree<Store>::~MerkleTree() {}
+template <typename Store, typename HashingPolicy> MerkleTree<Store, HashingPolicy>::~MerkleTree() {}
 
-template <typename Store> fr MerkleTree<Store>::root() const
+template <typename Store, typename HashingPolicy> fr MerkleTree<Store, HashingPolicy>::root() const
 {
     std::vector<uint8_t> root;
     std::vector<uint8_t> key = { tree_id_ };
     bool status = store_.get(key, root);
-    return status ? from_buffer<fr>(root) : hash_pair_native(zero_hashes_.back(), zero_hashes_.back());
+    return status ? from_buffer<fr>(root) : HashingPolicy::hash_pair(zero_hashes_.back(), zero_hashes_.back());
 }
 
-template <typename Store> typename MerkleTree<Store>::index_t MerkleTree<Store>::size() const
+template <typename Store, typename HashingPolicy>
+typename MerkleTree<Store, HashingPolicy>::index_t MerkleTree<Store, HashingPolicy>::size() const
 {
     std::vector<uint8_t> size_buf;
     std::vector<uint8_t> key = { tree_id_ };
@@ -66,12 +69,13 @@ template <typename Store> typename MerkleTree<Store>::index_t MerkleTree<Store>:
     return status ? from_buffer<index_t>(size_buf, 32) : 0;
 }
 
-template <typename Store> fr_hash_path MerkleTree<Store>::get_hash_path(index_t index)
+template <typename Store, typename HashingPolicy>
+fr_hash_path MerkleTree<Store, HashingPolicy>::get_hash_path(index_t index)
 {
     fr_hash_path path(depth_);
 
-    std::vector<uint8_t> data;
-    bool status = store_.get(root().to_buffer(), data);
+    MerkleNode node;
+    bool status = get_node(root(), node);
 
     for (size_t i = depth_ - 1; i < depth_; --i) {
         if (!status) {
@@ -80,20 +84,15 @@ template <typename Store> fr_hash_path MerkleTree<Store>::get_hash_path(index_t
             continue;
         }
 
-        if (data.size() == REGULAR_NODE_SIZE) {
+        if (!node.is_stump) {
             // This is a regular node with left and right trees. Descend according to index path.
-            auto left = from_buffer<fr>(data, 0);
-            auto right = from_buffer<fr>(data, 32);
-            path[i] = std::make_pair(left, right);
+            path[i] = std::make_pair(node.left, node.right);
             bool is_right = bit_set(index, i);
-            auto it = data.data() + (is_right ? 32 : 0);
-            status = store_.get(std::vector<uint8_t>(it, it + 32), data);
+            status = get_node(is_right ? node.right : node.left, node);
         } else {
             // This is a stump. The hash path can be fully restored from this node.
-            // In case of a stump, we store: [key : (value, local_index, true)], i.e. 65-byte data.
-            ASSERT(data.size() == STUMP_NODE_SIZE);
-            fr current = from_buffer<fr>(data, 0);
-            index_t element_index = from_buffer<index_t>(data, 32);
+            fr current = node.stump_value();
+            index_t element_index = node.index;
             index_t subtree_index = numeric::keep_n_lsb(index, i + 1);
             index_t diff = element_index ^ subtree_index;
 
@@ -107,7 +106,7 @@ template <typename Store> fr_hash_path MerkleTree<Store>::get_hash_path(index_t
                     } else {
                         path[j] = std::make_pair(current, zero_hashes_[j]);
                     }
-                    current = hash_pair_native(path[j].first, path[j].second);
+                    current = HashingPolicy::hash_pair(path[j].first, path[j].second);
                 }
             } else {
                 // Requesting path to a different, independent element.
@@ -127,7 +126,7 @@ template <typename Store> fr_hash_path MerkleTree<Store>::get_hash_path(index_t
                     } else {
                         path[j] = std::make_pair(current, zero_hashes_[j]);
                     }
-                    current = hash_pair_native(path[j].first, path[j].second);
+                    current = HashingPolicy::hash_pair(path[j].first, path[j].second);
                 }
             }
             break;
@@ -137,12 +136,13 @@ template <typename Store> fr_hash_path MerkleTree<Store>::get_hash_path(index_t
     return path;
 }
 
-template <typename Store> fr_sibling_path MerkleTree<Store>::get_sibling_path(index_t index)
+template <typename Store, typename HashingPolicy>
+fr_sibling_path MerkleTree<Store, HashingPolicy>::get_sibling_path(index_t index)
 {
     fr_sibling_path path(depth_);
 
-    std::vector<uint8_t> data;
-    bool status = store_.get(root().to_buffer(), data);
+    MerkleNode node;
+    bool status = get_node(root(), node);
 
     for (size_t i = depth_ - 1; i < depth_; --i) {
         if (!status) {
@@ -151,19 +151,15 @@ template <typename Store> fr_sibling_path MerkleTree<Store>::get_sibling_path(in
             continue;
         }
 
-        if (data.size() == REGULAR_NODE_SIZE) {
+        if (!node.is_stump) {
             // This is a regular node with left and right trees. Descend according to index path.
             bool is_right = bit_set(index, i);
-            path[i] = from_buffer<fr>(data, is_right ? 0 : 32);
-
-            auto it = data.data() + (is_right ? 32 : 0);
-            status = store_.get(std::vector<uint8_t>(it, it + 32), data);
+            path[i] = is_right ? node.left : node.right;
+            status = get_node(is_right ? node.right : node.left, node);
         } else {
             // This is a stump. The sibling path can be fully restored from this node.
-            // In case of a stump, we store: [key : (value, local_index, true)], i.e. 65-byte data.
-            ASSERT(data.size() == STUMP_NODE_SIZE);
-            fr current = from_buffer<fr>(data, 0);
-            index_t element_index = from_buffer<index_t>(data, 32);
+            fr current = node.stump_value();
+            index_t element_index = node.index;
             index_t subtree_index = numeric::keep_n_lsb(index, i + 1);
             index_t diff = element_index ^ subtree_index;
 
@@ -196,7 +192,8 @@ template <typename Store> fr_sibling_path MerkleTree<Store>::get_sibling_path(in
     return path;
 }
 
-template <typename Store> fr MerkleTree<Store>::update_element(index_t index, fr const& value)
+template <typename Store, typename HashingPolicy>
+fr MerkleTree<Store, HashingPolicy>::update_element(index_t index, fr const& value)
 {
     auto leaf = value;
     using serialize::write;
@@ -216,18 +213,19 @@ template <typename Store> fr MerkleTree<Store>::update_element(index_t index, fr
     return r;
 }
 
-template <typename Store> fr MerkleTree<Store>::binary_put(index_t a_index, fr const& a, fr const& b, size_t height)
+template <typename Store, typename HashingPolicy>
+fr MerkleTree<Store, HashingPolicy>::binary_put(index_t a_index, fr const& a, fr const& b, size_t height)
 {
     bool a_is_right = bit_set(a_index, height - 1);
     auto left = a_is_right ? b : a;
     auto right = a_is_right ? a : b;
-    auto key = hash_pair_native(left, right);
+    auto key = HashingPolicy::hash_pair(left, right);
     put(key, left, right);
     return key;
 }
 
-template <typename Store>
-fr MerkleTree<Store>::fork_stump(
+template <typename Store, typename HashingPolicy>
+fr MerkleTree<Store, HashingPolicy>::fork_stump(
     fr const& value1, index_t index1, fr const& value2, index_t index2, size_t height, size_t common_height)
 {
     if (height == common_height) {
@@ -252,16 +250,16 @@ fr MerkleTree<Store>::fork_stump(
     }
 }
 
-template <typename Store>
-fr MerkleTree<Store>::update_element(fr const& root, fr const& value, index_t index, size_t height)
+template <typename Store, typename HashingPolicy>
+fr MerkleTree<Store, HashingPolicy>::update_element(fr const& root, fr const& value, index_t index, size_t height)
 {
     // Base layer of recursion at height = 0.
     if (height == 0) {
         return value;
     }
 
-    std::vector<uint8_t> data;
-    auto status = store_.get(root.to_buffer(), data);
+    MerkleNode node;
+    auto status = get_node(root, node);
 
     if (!status) {
         fr key = compute_zero_path_hash(height, index, value);
@@ -269,9 +267,9 @@ fr MerkleTree<Store>::update_element(fr const& root, fr const& value, index_t in
         return key;
     }
 
-    if (data.size() == STUMP_NODE_SIZE) {
+    if (node.is_stump) {
         // We've come across a stump.
-        index_t existing_index = from_buffer<index_t>(data, 32);
+        index_t existing_index = node.index;
 
         if (existing_index == index) {
             // We are updating the stumps element. Easy update.
@@ -280,26 +278,24 @@ fr MerkleTree<Store>::update_element(fr const& root, fr const& value, index_t in
             return new_hash;
         }
 
-        fr existing_value = from_buffer<fr>(data, 0);
+        fr existing_value = node.stump_value();
         size_t common_bits = numeric::count_leading_zeros(existing_index ^ index);
         size_t common_height = sizeof(index_t) * 8 - common_bits;
 
         return fork_stump(existing_value, existing_index, value, index, height, common_height);
     } else {
-        // If its not a stump, the data size must be 64 bytes.
-        ASSERT(data.size() == REGULAR_NODE_SIZE);
         bool is_right = bit_set(index, height - 1);
-        fr subtree_root = from_buffer<fr>(data, is_right ? 32 : 0);
+        fr subtree_root = is_right ? node.right : node.left;
         fr subtree_root_copy = subtree_root;
-        auto left = from_buffer<fr>(data, 0);
-        auto right = from_buffer<fr>(data, 32);
+        auto left = node.left;
+        auto right = node.right;
         subtree_root = update_element(subtree_root, value, numeric::keep_n_lsb(index, height - 1), height - 1);
         if (is_right) {
             right = subtree_root;
         } else {
             left = subtree_root;
         }
-        auto new_root = hash_pair_native(left, right);
+        auto new_root = HashingPolicy::hash_pair(left, right);
         put(new_root, left, right);
 
         // Remove the old node only while rolling back in recursion.
@@ -310,7 +306,8 @@ fr MerkleTree<Store>::update_element(fr const& root, fr const& value, index_t in
     }
 }
 
-template <typename Store> fr MerkleTree<Store>::compute_zero_path_hash(size_t height, index_t index, fr const& value)
+template <typename Store, typename HashingPolicy>
+fr MerkleTree<Store, HashingPolicy>::compute_zero_path_hash(size_t height, index_t index, fr const& value)
 {
     fr current = value;
     for (size_t i = 0; i < height; ++i) {
@@ -323,35 +320,60 @@ template <typename Store> fr MerkleTree<Store>::compute_zero_path_hash(size_t he
             right = zero_hashes_[i];
             left = current;
         }
-        current = hash_pair_native(left, right);
+        current = HashingPolicy::hash_pair(left, right);
     }
     return current;
 }
 
-template <typename Store> void MerkleTree<Store>::put(fr const& key, fr const& left, fr const& right)
+template <typename Store, typename HashingPolicy>
+void MerkleTree<Store, HashingPolicy>::put(fr const& key, fr const& left, fr const& right)
+{
+    put_node(key, MerkleNode::regular(left, right));
+}
+
+template <typename Store, typename HashingPolicy>
+void MerkleTree<Store, HashingPolicy>::put_stump(fr const& key, index_t index, fr const& value)
 {
-    std::vector<uint8_t> value;
-    write(value, left);
-    write(value, right);
-    store_.put(key.to_buffer(), value);
+    put_node(key, MerkleNode::stump(value, index));
 }
 
-template <typename Store> void MerkleTree<Store>::put_stump(fr const& key, index_t index, fr const& value)
+template <typename Store, typename HashingPolicy> void MerkleTree<Store, HashingPolicy>::remove(fr const& key)
 {
-    std::vector<uint8_t> buf;
-    write(buf, value);
-    write(buf, index);
-    // Add an additional byte, to signify we are a stump.
-    write(buf, true);
-    store_.put(key.to_buffer(), buf);
+    fr::serialize_to_buffer(key, key_buf_.data());
+    store_.del(key_buf_);
+    node_cache_.erase(key);
+}
+
+template <typename Store, typename HashingPolicy>
+bool MerkleTree<Store, HashingPolicy>::get_node(fr key, MerkleNode& node)
+{
+    if (node_cache_.get(key, node)) {
+        return true;
+    }
+    fr::serialize_to_buffer(key, key_buf_.data());
+    if (!store_.get(key_buf_, value_buf_)) {
+        return false;
+    }
+    node = MerkleNode::read(value_buf_);
+    node_cache_.put(key, node);
+    return true;
 }
 
-template <typename Store> void MerkleTree<Store>::remove(fr const& key)
+template <typename Store, typename HashingPolicy>
+void MerkleTree<Store, HashingPolicy>::put_node(fr const& key, MerkleNode const& node)
 {
-    store_.del(key.to_buffer());
+    fr::serialize_to_buffer(key, key_buf_.data());
+    node.write(value_buf_);
+    store_.put(key_buf_, value_buf_);
+    node_cache_.put(key, node);
 }
 
-template class MerkleTree<MemoryStore>;
+template class MerkleTree<MemoryStore, PedersenHashPolicy>;
+template class MerkleTree<FileStore, PedersenHashPolicy>;
+template class MerkleTree<FileStoreSnapshot, PedersenHashPolicy>;
+template class MerkleTree<MemoryStore, Poseidon2HashPolicy>;
+template class MerkleTree<FileStore, Poseidon2HashPolicy>;
+template class MerkleTree<FileStoreSnapshot, Poseidon2HashPolicy>;
 
 } // namespace merkle_tree
 } // namespace stdlib
@@ -1,6 +1,8 @@
 #pragma once
 #include "barretenberg/stdlib/primitives/field/field.hpp"
+#include "hash.hpp"
 #include "hash_path.hpp"
+#include "node_cache.hpp"
 
 namespace proof_system::plonk {
 namespace stdlib {
@@ -9,12 +11,24 @@ namespace merkle_tree {
 using namespace barretenberg;
 
 class MemoryStore;
-
-template <typename Store> class MerkleTree {
+class FileStore;
+class FileStoreSnapshot;
+
+/**
+ * A sparse merkle tree whose nodes are kept in `Store`, keyed by their hash (see MerkleNode), hashed with HashingPolicy
+ * (see hash.hpp).
+ *
+ * Nodes read from or written to the store are also kept in a NodeCache, so walking the top of the tree, which every
+ * update and path shares, does not go to the store or allocate. As the cache is updated on reads, a tree must not be
+ * used from several threads at once, not even for reads (give each reader its own tree over the same store instead).
+ */
+template <typename Store, typename HashingPolicy = PedersenHashPolicy> class MerkleTree {
   public:
     typedef uint256_t index_t;
 
-    MerkleTree(Store& store, size_t depth, uint8_t tree_id = 0);
+    static constexpr size_t DEFAULT_NODE_CACHE_SLOTS = 1 << 15;
+
+    MerkleTree(Store& store, size_t depth, uint8_t tree_id = 0, size_t node_cache_slots = DEFAULT_NODE_CACHE_SLOTS);
     MerkleTree(MerkleTree const& other) = delete;
     MerkleTree(MerkleTree&& other);
     ~MerkleTree();
@@ -90,14 +104,31 @@ template <typename Store> class MerkleTree {
 
     void remove(fr const& key);
 
+    /**
+     * Reads the node stored under `key`, from the cache if possible. Returns false if there is none, i.e. `key` is the
+     * root of an empty subtree. `key` is taken by value, as it is often a child of `node` itself.
+     */
+    bool get_node(fr key, MerkleNode& node);
+
+    void put_node(fr const& key, MerkleNode const& node);
+
   protected:
     Store& store_;
     std::vector<fr> zero_hashes_;
     size_t depth_;
     uint8_t tree_id_;
+    NodeCache node_cache_;
+    // Buffers for talking to the store, reused so that the encoding of a node doesn't allocate
+    std::vector<uint8_t> key_buf_;
+    std::vector<uint8_t> value_buf_;
 };
 
-extern template class MerkleTree<MemoryStore>;
+extern template class MerkleTree<MemoryStore, PedersenHashPolicy>;
+extern template class MerkleTree<FileStore, PedersenHashPolicy>;
+extern template class MerkleTree<FileStoreSnapshot, PedersenHashPolicy>;
+extern template class MerkleTree<MemoryStore, Poseidon2HashPolicy>;
+extern template class MerkleTree<FileStore, Poseidon2HashPolicy>;
+extern template class MerkleTree<FileStoreSnapshot, Poseidon2HashPolicy>;
 
 } // namespace merkle_tree
 } // namespace stdlib
@@ -55,6 +55,49 @@ TEST(stdlib_merkle_tree, test_kv_memory_vs_memory_consistency)
     EXPECT_EQ(db.root(), memdb.root());
 }
 
+TEST(stdlib_merkle_tree, test_poseidon2_kv_memory_vs_memory_consistency)
+{
+    constexpr size_t depth = 10;
+    MemoryTree_<Poseidon2HashPolicy> memdb(depth);
+
+    MemoryStore store;
+    MerkleTree<MemoryStore, Poseidon2HashPolicy> db(store, depth);
+    EXPECT_EQ(db.root(), memdb.root());
+
+    for (size_t i = 0; i < 64; ++i) {
+        size_t idx = (i * 37) % (1 << depth);
+        memdb.update_element(idx, VALUES[i]);
+        db.update_element(idx, VALUES[i]);
+        EXPECT_EQ(db.root(), memdb.root());
+    }
+    for (size_t i = 0; i < 64; ++i) {
+        size_t idx = (i * 37) % (1 << depth);
+        EXPECT_EQ(db.get_hash_path(idx), memdb.get_hash_path(idx));
+    }
+}
+
+TEST(stdlib_merkle_tree, test_node_cache_sizes)
+{
+    // A cache far smaller than the tree keeps evicting nodes, which must then come from the store
+    constexpr size_t depth = 10;
+    for (size_t cache_slots : { 0UL, 16UL, 1UL << 12 }) {
+        MemoryTree memdb(depth);
+        MemoryStore store;
+        MerkleTree db(store, depth, 0, cache_slots);
+
+        for (size_t i = 0; i < 256; ++i) {
+            size_t idx = (i * 389) % (1 << depth);
+            memdb.update_element(idx, VALUES[i]);
+            db.update_element(idx, VALUES[i]);
+            EXPECT_EQ(db.get_sibling_path(idx), memdb.get_sibling_path(idx));
+        }
+        for (size_t idx = 0; idx < (1 << depth); idx += 37) {
+            EXPECT_EQ(db.get_hash_path(idx), memdb.get_hash_path(idx));
+        }
+        EXPECT_EQ(db.root(), memdb.root());
+    }
+}
+
 TEST(stdlib_merkle_tree, test_size)
 {
     MemoryStore store;
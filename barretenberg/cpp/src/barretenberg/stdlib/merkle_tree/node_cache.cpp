@@ -0,0 +1,165 @@
+#include "node_cache.hpp"
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/numeric/bitop/pow.hpp"
+#include <algorithm>
+
+namespace proof_system::plonk {
+namespace stdlib {
+namespace merkle_tree {
+
+void MerkleNode::write(std::vector<uint8_t>& buf) const
+{
+    using serialize::write;
+    buf.resize(is_stump ? STUMP_SIZE : REGULAR_SIZE);
+    uint8_t* it = buf.data();
+    write(it, left);
+    if (is_stump) {
+        write(it, index);
+        write(it, true);
+    } else {
+        write(it, right);
+    }
+}
+
+MerkleNode MerkleNode::read(std::vector<uint8_t> const& buf)
+{
+    using serialize::read;
+    ASSERT(buf.size() == REGULAR_SIZE || buf.size() == STUMP_SIZE);
+    MerkleNode node;
+    uint8_t const* it = buf.data();
+    read(it, node.left);
+    node.is_stump = buf.size() == STUMP_SIZE;
+    if (node.is_stump) {
+        read(it, node.index);
+    } else {
+        read(it, node.right);
+    }
+    return node;
+}
+
+NodeCache::NodeCache(size_t num_slots)
+{
+    if (num_slots == 0) {
+        return;
+    }
+    num_slots = std::max(num_slots, size_t(4));
+    max_slots_ =
+        numeric::is_power_of_two(num_slots) ? num_slots : size_t(1) << (numeric::get_msb(uint64_t(num_slots)) + 1);
+}
+
+// Allocates the table, or doubles it, and reinserts the entries
+void NodeCache::grow()
+{
+    const size_t num_slots = slots_.empty() ? std::min(INITIAL_SLOTS, max_slots_) : slots_.size() * 2;
+    std::vector<Slot> old_slots(num_slots);
+    std::swap(slots_, old_slots);
+    mask_ = num_slots - 1;
+    max_size_ = num_slots / 4 * 3;
+    hand_ = 0;
+    for (auto const& slot : old_slots) {
+        if (slot.occupied) {
+            slots_[find(slot.key)] = slot;
+        }
+    }
+}
+
+size_t NodeCache::find(fr const& key) const
+{
+    // The table is never full, so we always reach an empty slot
+    size_t slot = home_slot(key);
+    while (slots_[slot].occupied && slots_[slot].key != key) {
+        slot = (slot + 1) & mask_;
+    }
+    return slot;
+}
+
+bool NodeCache::get(fr const& key, MerkleNode& node)
+{
+    if (slots_.empty()) {
+        return false;
+    }
+    Slot& slot = slots_[find(key)];
+    if (!slot.occupied) {
+        return false;
+    }
+    slot.referenced = true;
+    node = slot.node;
+    return true;
+}
+
+void NodeCache::put(fr const& key, MerkleNode const& node)
+{
+    if (max_slots_ == 0) {
+        return;
+    }
+    if (slots_.empty()) {
+        grow();
+    }
+    size_t slot = find(key);
+    if (!slots_[slot].occupied) {
+        if (size_ == max_size_) {
+            if (slots_.size() < max_slots_) {
+                grow();
+            } else {
+                evict();
+            }
+            // Growing and eviction move entries around, the free slot for our key may have moved
+            slot = find(key);
+        }
+        ++size_;
+    }
+    slots_[slot] = { key, node, true, true };
+}
+
+void NodeCache::erase(fr const& key)
+{
+    if (slots_.empty()) {
+        return;
+    }
+    const size_t slot = find(key);
+    if (slots_[slot].occupied) {
+        erase_slot(slot);
+    }
+}
+
+/**
+ * Empties `slot`, then moves later entries of its probe run back, so that no entry is separated from its home slot by
+ * an empty slot (which would end its lookups early).
+ */
+void NodeCache::erase_slot(size_t slot)
+{
+    slots_[slot].occupied = false;
+    --size_;
+    size_t next = slot;
+    while (true) {
+        next = (next + 1) & mask_;
+        if (!slots_[next].occupied) {
+            break;
+        }
+        const size_t home = home_slot(slots_[next].key);
+        // The entry can move to the empty slot if that lies between its home slot and its current slot
+        if (((next - home) & mask_) >= ((next - slot) & mask_)) {
+            slots_[slot] = slots_[next];
+            slots_[next].occupied = false;
+            slot = next;
+        }
+    }
+}
+
+void NodeCache::evict()
+{
+    while (true) {
+        Slot& slot = slots_[hand_];
+        if (slot.occupied && !slot.referenced) {
+            erase_slot(hand_);
+            return;
+        }
+        slot.referenced = false;
+        hand_ = (hand_ + 1) & mask_;
+    }
+}
+
+} // namespace merkle_tree
+} // namespace stdlib
+} // namespace proof_system::plonk
@@ -0,0 +1,92 @@
+#pragma once
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <vector>
+
+namespace proof_system::plonk {
+namespace stdlib {
+namespace merkle_tree {
+
+using namespace barretenberg;
+
+/**
+ * A node of a MerkleTree, as stored under its hash. Either a regular node with its two children, or a stump: a subtree
+ * that is empty other than one leaf, stored as the leaf's value and its index within the subtree.
+ *
+ * In a store, a regular node is encoded as (left, right), i.e. 64 bytes, and a stump as (value, index, true), i.e. 65
+ * bytes.
+ */
+struct MerkleNode {
+    static constexpr size_t REGULAR_SIZE = 64;
+    static constexpr size_t STUMP_SIZE = 65;
+
+    fr left;
+    fr right;
+    uint256_t index;
+    bool is_stump = false;
+
+    static MerkleNode regular(fr const& left, fr const& right) { return { left, right, 0, false }; }
+    static MerkleNode stump(fr const& value, uint256_t const& index) { return { value, 0, index, true }; }
+
+    fr const& stump_value() const { return left; }
+
+    // Encodes into `buf`, reusing its memory
+    void write(std::vector<uint8_t>& buf) const;
+    static MerkleNode read(std::vector<uint8_t> const& buf);
+};
+
+/**
+ * A fixed size cache of MerkleNodes by hash, in front of a MerkleTree's store.
+ *
+ * An open addressing (linear probing) table. It starts small and doubles whenever it is 3/4 full, up to its maximum
+ * size, so a tree that only ever touches a few nodes does not pay for a large table. Once at its maximum size, lookups
+ * and inserts never allocate, and inserting into a 3/4 full table evicts an entry with the CLOCK policy: a hand sweeps
+ * the slots, clearing their referenced bit, and evicts the first entry that has not been used since the hand last
+ * passed it.
+ *
+ * Nodes are stored under their hash, so a node can never be stale: the cache only has to drop nodes that are removed
+ * from the tree. It is not thread-safe.
+ */
+class NodeCache {
+  public:
+    /**
+     * @param num_slots the maximum size of the table, rounded up to a power of 2. Zero disables the cache.
+     */
+    explicit NodeCache(size_t num_slots);
+
+    bool get(fr const& key, MerkleNode& node);
+
+    void put(fr const& key, MerkleNode const& node);
+
+    void erase(fr const& key);
+
+    size_t size() const { return size_; }
+
+  private:
+    // The size of the table once the first node is inserted
+    static constexpr size_t INITIAL_SLOTS = 64;
+
+    struct Slot {
+        fr key;
+        MerkleNode node;
+        bool occupied = false;
+        bool referenced = false;
+    };
+
+    size_t home_slot(fr const& key) const { return static_cast<size_t>(key.data[0]) & mask_; }
+    size_t find(fr const& key) const;
+    void erase_slot(size_t slot);
+    void grow();
+    void evict();
+
+    std::vector<Slot> slots_;
+    size_t max_slots_ = 0;
+    size_t mask_ = 0;
+    size_t max_size_ = 0;
+    size_t size_ = 0;
+    size_t hand_ = 0;
+};
+
+} // namespace merkle_tree
+} // namespace stdlib
+} // namespace proof_system::plonk
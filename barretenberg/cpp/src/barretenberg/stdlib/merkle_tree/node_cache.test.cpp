@@ -0,0 +1,90 @@
+#include "node_cache.hpp"
+#include "barretenberg/common/test.hpp"
+#include <map>
+
+namespace proof_system::test_stdlib_merkle_tree_node_cache {
+
+using namespace proof_system::plonk::stdlib::merkle_tree;
+
+TEST(stdlib_merkle_tree_node_cache, node_encoding)
+{
+    std::vector<uint8_t> buf;
+    auto regular = MerkleNode::regular(fr::random_element(), fr::random_element());
+    regular.write(buf);
+    EXPECT_EQ(buf.size(), MerkleNode::REGULAR_SIZE);
+    auto decoded = MerkleNode::read(buf);
+    EXPECT_FALSE(decoded.is_stump);
+    EXPECT_EQ(decoded.left, regular.left);
+    EXPECT_EQ(decoded.right, regular.right);
+
+    auto stump = MerkleNode::stump(fr::random_element(), uint256_t(1, 2, 3, 4));
+    stump.write(buf);
+    EXPECT_EQ(buf.size(), MerkleNode::STUMP_SIZE);
+    decoded = MerkleNode::read(buf);
+    EXPECT_TRUE(decoded.is_stump);
+    EXPECT_EQ(decoded.stump_value(), stump.stump_value());
+    EXPECT_EQ(decoded.index, stump.index);
+}
+
+TEST(stdlib_merkle_tree_node_cache, matches_map_under_eviction)
+{
+    // Keys with few distinct low bits, so that probe runs collide and wrap around the table
+    constexpr size_t num_slots = 16;
+    NodeCache cache(num_slots);
+    std::map<uint64_t, MerkleNode> reference;
+    const auto key = [](uint64_t i) { return fr{ i % 5, i, 0, 0 }; };
+
+    MerkleNode node;
+    for (uint64_t i = 0; i < 2000; ++i) {
+        const uint64_t k = (i * 7919) % 41;
+        if (i % 3 == 0) {
+            cache.erase(key(k));
+            reference.erase(k);
+        } else {
+            auto value = MerkleNode::regular(fr(i), fr(k));
+            cache.put(key(k), value);
+            reference[k] = value;
+        }
+        EXPECT_LE(cache.size(), num_slots / 4 * 3);
+
+        // Everything cached is up to date, and the most recent insert is always cached
+        size_t num_cached = 0;
+        for (auto const& [k2, value] : reference) {
+            if (cache.get(key(k2), node)) {
+                EXPECT_EQ(node.left, value.left);
+                ++num_cached;
+            }
+        }
+        EXPECT_EQ(num_cached, cache.size());
+        if (i % 3 != 0) {
+            EXPECT_TRUE(cache.get(key(k), node));
+        }
+    }
+
+    NodeCache disabled(0);
+    disabled.put(key(1), node);
+    EXPECT_FALSE(disabled.get(key(1), node));
+}
+
+TEST(stdlib_merkle_tree_node_cache, grows_before_evicting)
+{
+    constexpr size_t num_slots = 1 << 10;
+    NodeCache cache(num_slots);
+    MerkleNode node;
+    EXPECT_FALSE(cache.get(fr(1), node));
+
+    // Nothing is evicted until the table has reached its full size
+    constexpr size_t max_size = num_slots / 4 * 3;
+    for (uint64_t i = 0; i < max_size; ++i) {
+        cache.put(fr(i), MerkleNode::regular(fr(i), fr(i)));
+    }
+    EXPECT_EQ(cache.size(), max_size);
+    for (uint64_t i = 0; i < max_size; ++i) {
+        EXPECT_TRUE(cache.get(fr(i), node));
+        EXPECT_EQ(node.left, fr(i));
+    }
+    cache.put(fr(max_size), MerkleNode::regular(fr(0), fr(0)));
+    EXPECT_EQ(cache.size(), max_size);
+}
+
+} // namespace proof_system::test_stdlib_merkle_tree_node_cache
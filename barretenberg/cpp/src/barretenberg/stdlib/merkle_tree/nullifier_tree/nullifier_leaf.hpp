@@ -1,6 +1,10 @@
 #pragma once
+#include "../hash.hpp"
 #include "barretenberg/crypto/pedersen_commitment/pedersen.hpp"
 #include "barretenberg/serialize/msgpack.hpp"
+#include <algorithm>
+#include <map>
+#include <vector>
 
 namespace proof_system::plonk {
 namespace stdlib {
@@ -24,7 +28,10 @@ struct nullifier_leaf {
         return os;
     }
 
-    barretenberg::fr hash() const { return stdlib::merkle_tree::hash_native({ value, nextIndex, nextValue }); }
+    template <typename HashingPolicy = PedersenHashPolicy> barretenberg::fr hash() const
+    {
+        return HashingPolicy::hash({ value, nextIndex, nextValue });
+    }
 };
 
 /**
@@ -72,7 +79,10 @@ class WrappedNullifierLeaf {
      *
      * @return barretenberg::fr
      */
-    barretenberg::fr hash() const { return data.has_value() ? data.value().hash() : barretenberg::fr::zero(); }
+    template <typename HashingPolicy = PedersenHashPolicy> barretenberg::fr hash() const
+    {
+        return data.has_value() ? data.value().hash<HashingPolicy>() : barretenberg::fr::zero();
+    }
 
     /**
      * @brief Generate a zero leaf (call the constructor with no arguments)
@@ -113,6 +123,84 @@ inline std::pair<size_t, bool> find_closest_leaf(std::vector<WrappedNullifierLea
     return std::make_pair(static_cast<size_t>(it - diff.begin()), repeated);
 }
 
+/**
+ * @brief Ordered index from the values of the leaves of a nullifier tree to their positions
+ * @details Empty leaves and the initial leaf all have value 0, which maps to the initial leaf at index 0. Any other
+ * value appears in at most one leaf.
+ */
+using NullifierLeafIndex = std::map<uint256_t, size_t>;
+
+/**
+ * @brief O(log n) version of the above: finds the leaf with the largest value not greater than `new_value`
+ */
+inline std::pair<size_t, bool> find_closest_leaf(NullifierLeafIndex const& leaf_indices, fr const& new_value)
+{
+    const auto new_value_ = uint256_t(new_value);
+    // The index always holds the initial leaf of value 0, so every value has a predecessor
+    auto it = std::prev(leaf_indices.upper_bound(new_value_));
+    return std::make_pair(it->second, it->first == new_value_);
+}
+
+/**
+ * @brief Inserts `values` into the linked list of `leaves`, with the same result as inserting them one by one
+ * @details New leaves are appended in the order of `values` (zero values append an empty leaf if
+ * `append_empty_leaf_for_zero` is set, and are skipped otherwise). Values that are already present are skipped. The
+ * new values are sorted once and linked to their neighbours in a single ordered pass over the index.
+ *
+ * @return The sorted indices of all leaves that changed, and whose hashes must therefore be updated
+ */
+inline std::vector<size_t> batch_insert_leaves(std::vector<WrappedNullifierLeaf>& leaves,
+                                               NullifierLeafIndex& leaf_indices,
+                                               std::vector<fr> const& values,
+                                               bool append_empty_leaf_for_zero)
+{
+    std::vector<std::pair<uint256_t, size_t>> new_leaves;
+    new_leaves.reserve(values.size());
+    for (const auto& value : values) {
+        if (value == 0) {
+            if (append_empty_leaf_for_zero) {
+                leaves.push_back(WrappedNullifierLeaf::zero());
+            }
+            continue;
+        }
+        const size_t index = leaves.size();
+        if (!leaf_indices.emplace(uint256_t(value), index).second) {
+            continue;
+        }
+        leaves.push_back(WrappedNullifierLeaf(nullifier_leaf{ .value = value, .nextIndex = 0, .nextValue = 0 }));
+        new_leaves.emplace_back(uint256_t(value), index);
+    }
+    std::sort(new_leaves.begin(), new_leaves.end());
+
+    std::vector<size_t> updated_indices;
+    updated_indices.reserve(new_leaves.size() * 2);
+    for (const auto& [value, index] : new_leaves) {
+        // All new values are in the index already, so a leaf's neighbours in the index are its final neighbours in the
+        // list. A low leaf only needs updating if its successor is new, i.e. it is the predecessor of a new value.
+        const auto it = leaf_indices.find(value);
+        const auto low_leaf = std::prev(it);
+        const auto next_leaf = std::next(it);
+
+        nullifier_leaf new_leaf = leaves[index].unwrap();
+        if (next_leaf != leaf_indices.end()) {
+            new_leaf.nextIndex = next_leaf->second;
+            new_leaf.nextValue = next_leaf->first;
+        }
+        leaves[index].set(new_leaf);
+
+        nullifier_leaf updated_low_leaf = leaves[low_leaf->second].unwrap();
+        updated_low_leaf.nextIndex = index;
+        updated_low_leaf.nextValue = new_leaf.value;
+        leaves[low_leaf->second].set(updated_low_leaf);
+
+        updated_indices.push_back(low_leaf->second);
+        updated_indices.push_back(index);
+    }
+    std::sort(updated_indices.begin(), updated_indices.end());
+    updated_indices.erase(std::unique(updated_indices.begin(), updated_indices.end()), updated_indices.end());
+    return updated_indices;
+}
+
 } // namespace merkle_tree
 } // namespace stdlib
 } // namespace proof_system::plonk
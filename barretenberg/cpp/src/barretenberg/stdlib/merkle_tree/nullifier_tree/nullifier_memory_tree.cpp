@@ -5,30 +5,32 @@ namespace proof_system::plonk {
 namespace stdlib {
 namespace merkle_tree {
 
-NullifierMemoryTree::NullifierMemoryTree(size_t depth)
-    : MemoryTree(depth)
+template <typename HashingPolicy>
+NullifierMemoryTree_<HashingPolicy>::NullifierMemoryTree_(size_t depth)
+    : MemoryTree_<HashingPolicy>(depth)
 {
     ASSERT(depth_ >= 1 && depth <= 32);
     total_size_ = 1UL << depth_;
     hashes_.resize(total_size_ * 2 - 2);
 
     // Build the entire tree and fill with 0 hashes.
-    auto current = WrappedNullifierLeaf::zero().hash();
+    auto current = WrappedNullifierLeaf::zero().hash<HashingPolicy>();
     size_t layer_size = total_size_;
     for (size_t offset = 0; offset < hashes_.size(); offset += layer_size, layer_size /= 2) {
         for (size_t i = 0; i < layer_size; ++i) {
             hashes_[offset + i] = current;
         }
-        current = hash_pair_native(current, current);
+        current = HashingPolicy::hash_pair(current, current);
     }
 
     // Insert the initial leaf at index 0
     auto initial_leaf = WrappedNullifierLeaf(nullifier_leaf{ .value = 0, .nextIndex = 0, .nextValue = 0 });
     leaves_.push_back(initial_leaf);
-    root_ = update_element(0, initial_leaf.hash());
+    leaf_indices_.emplace(0, 0);
+    root_ = update_element(0, initial_leaf.hash<HashingPolicy>());
 }
 
-fr NullifierMemoryTree::update_element(fr const& value)
+template <typename HashingPolicy> fr NullifierMemoryTree_<HashingPolicy>::update_element(fr const& value)
 {
     // Find the leaf with the value closest and less than `value`
 
@@ -36,12 +38,12 @@ fr NullifierMemoryTree::update_element(fr const& value)
     if (value == 0) {
         auto zero_leaf = WrappedNullifierLeaf::zero();
         leaves_.push_back(zero_leaf);
-        return update_element(leaves_.size() - 1, zero_leaf.hash());
+        return update_element(leaves_.size() - 1, zero_leaf.hash<HashingPolicy>());
     }
 
     size_t current;
     bool is_already_present;
-    std::tie(current, is_already_present) = find_closest_leaf(leaves_, value);
+    std::tie(current, is_already_present) = find_closest_leaf(leaf_indices_, value);
 
     nullifier_leaf current_leaf = leaves_[current].unwrap();
     nullifier_leaf new_leaf = { .value = value,
@@ -56,22 +58,35 @@ fr NullifierMemoryTree::update_element(fr const& value)
         leaves_[current].set(current_leaf);
 
         // Insert the new leaf with (nextIndex, nextValue) of the current leaf
+        leaf_indices_.emplace(uint256_t(value), leaves_.size());
         leaves_.push_back(new_leaf);
     }
 
     // Update the old leaf in the tree
-    auto old_leaf_hash = current_leaf.hash();
+    auto old_leaf_hash = current_leaf.hash<HashingPolicy>();
     size_t old_leaf_index = current;
     auto root = update_element(old_leaf_index, old_leaf_hash);
 
     // Insert the new leaf in the tree
-    auto new_leaf_hash = new_leaf.hash();
+    auto new_leaf_hash = new_leaf.hash<HashingPolicy>();
     size_t new_leaf_index = is_already_present ? old_leaf_index : leaves_.size() - 1;
     root = update_element(new_leaf_index, new_leaf_hash);
 
     return root;
 }
 
+template <typename HashingPolicy> fr NullifierMemoryTree_<HashingPolicy>::batch_insert(std::vector<fr> const& values)
+{
+    std::vector<std::pair<size_t, fr>> updates;
+    for (size_t index : batch_insert_leaves(leaves_, leaf_indices_, values, true)) {
+        updates.emplace_back(index, leaves_[index].hash<HashingPolicy>());
+    }
+    return update_elements(updates);
+}
+
+template class NullifierMemoryTree_<PedersenHashPolicy>;
+template class NullifierMemoryTree_<Poseidon2HashPolicy>;
+
 } // namespace merkle_tree
 } // namespace stdlib
 } // namespace proof_system::plonk
\ No newline at end of file
@@ -67,17 +67,26 @@ using namespace barretenberg;
  *  nextIdx   2       4       3       1        0       0       0       0
  *  nextVal   10      50      20      30       0       0       0       0
  */
-class NullifierMemoryTree : public MemoryTree {
+template <typename HashingPolicy> class NullifierMemoryTree_ : public MemoryTree_<HashingPolicy> {
 
   public:
-    NullifierMemoryTree(size_t depth);
+    NullifierMemoryTree_(size_t depth);
 
-    using MemoryTree::get_hash_path;
-    using MemoryTree::root;
-    using MemoryTree::update_element;
+    using MemoryTree_<HashingPolicy>::get_hash_path;
+    using MemoryTree_<HashingPolicy>::root;
+    using MemoryTree_<HashingPolicy>::update_element;
+    using MemoryTree_<HashingPolicy>::update_elements;
 
     fr update_element(fr const& value);
 
+    /**
+     * @brief Inserts all of `values`, with the same resulting tree as calling `update_element` on each in turn
+     * @details The values are sorted once to link the new leaves, and every changed leaf is hashed in only once.
+     *
+     * @return The new root
+     */
+    fr batch_insert(std::vector<fr> const& values);
+
     const std::vector<barretenberg::fr>& get_hashes() { return hashes_; }
     const WrappedNullifierLeaf get_leaf(size_t index)
     {
@@ -86,13 +95,19 @@ class NullifierMemoryTree : public MemoryTree {
     const std::vector<WrappedNullifierLeaf>& get_leaves() { return leaves_; }
 
   protected:
-    using MemoryTree::depth_;
-    using MemoryTree::hashes_;
-    using MemoryTree::root_;
-    using MemoryTree::total_size_;
+    using MemoryTree_<HashingPolicy>::depth_;
+    using MemoryTree_<HashingPolicy>::hashes_;
+    using MemoryTree_<HashingPolicy>::root_;
+    using MemoryTree_<HashingPolicy>::total_size_;
     std::vector<WrappedNullifierLeaf> leaves_;
+    NullifierLeafIndex leaf_indices_;
 };
 
+extern template class NullifierMemoryTree_<PedersenHashPolicy>;
+extern template class NullifierMemoryTree_<Poseidon2HashPolicy>;
+
+using NullifierMemoryTree = NullifierMemoryTree_<PedersenHashPolicy>;
+
 } // namespace merkle_tree
 } // namespace stdlib
 } // namespace proof_system::plonk
\ No newline at end of file
@@ -368,4 +368,39 @@ TEST(crypto_nullifier_tree, test_nullifier_tree)
     // Merkle proof at `index` proves non-membership of `new_member`
     auto hash_path = tree.get_hash_path(index);
     EXPECT_TRUE(check_hash_path(tree.root(), hash_path, leaves[index].unwrap(), index));
-}
\ No newline at end of file
+}
+
+TEST(crypto_nullifier_tree, test_nullifier_memory_batch_insert)
+{
+    constexpr size_t depth = 8;
+    NullifierMemoryTree sequential_tree(depth);
+    NullifierMemoryTree batch_tree(depth);
+
+    // Random values, with repeats (within the batch and of earlier values) and zeros
+    std::vector<fr> first_batch;
+    for (size_t i = 0; i < 40; i++) {
+        first_batch.push_back(fr::random_element());
+    }
+    first_batch[7] = 0;
+    first_batch[13] = first_batch[2];
+    std::vector<fr> second_batch = { first_batch[5], 0, fr(1), fr(-1) };
+    for (size_t i = 0; i < 40; i++) {
+        second_batch.push_back(fr::random_element());
+    }
+
+    for (const auto& batch : { first_batch, second_batch }) {
+        for (const auto& value : batch) {
+            sequential_tree.update_element(value);
+        }
+        EXPECT_EQ(batch_tree.batch_insert(batch), sequential_tree.root());
+        EXPECT_EQ(batch_tree.get_leaves(), sequential_tree.get_leaves());
+        EXPECT_EQ(batch_tree.get_hashes(), sequential_tree.get_hashes());
+    }
+
+    // Inserting one by one after a batch insert still finds the right low leaves
+    for (size_t i = 0; i < 10; i++) {
+        const fr value = fr::random_element();
+        EXPECT_EQ(batch_tree.update_element(value), sequential_tree.update_element(value));
+    }
+    EXPECT_EQ(batch_tree.get_leaves(), sequential_tree.get_leaves());
+}
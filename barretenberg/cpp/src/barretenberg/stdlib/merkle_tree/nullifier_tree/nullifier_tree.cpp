@@ -20,9 +20,9 @@ template <typename T> inline bool bit_set(T const& index, size_t i)
     return bool((index >> i) & 0x1);
 }
 
-template <typename Store>
-NullifierTree<Store>::NullifierTree(Store& store, size_t depth, uint8_t tree_id)
-    : MerkleTree<Store>(store, depth, tree_id)
+template <typename Store, typename HashingPolicy>
+NullifierTree<Store, HashingPolicy>::NullifierTree(Store& store, size_t depth, uint8_t tree_id)
+    : MerkleTree<Store, HashingPolicy>(store, depth, tree_id)
 {
     ASSERT(depth_ >= 1 && depth <= 256);
     zero_hashes_.resize(depth);
@@ -32,29 +32,33 @@ NullifierTree<Store>::NullifierTree(Store& store, size_t depth, uint8_t tree_id)
     WrappedNullifierLeaf initial_leaf =
         WrappedNullifierLeaf(nullifier_leaf{ .value = 0, .nextIndex = 0, .nextValue = 0 });
     leaves.push_back(initial_leaf);
-    update_element(0, initial_leaf.hash());
+    leaf_indices.emplace(0, 0);
+    update_element(0, initial_leaf.hash<HashingPolicy>());
 
     // Create the zero hashes for the tree
-    auto current = WrappedNullifierLeaf::zero().hash();
+    auto current = WrappedNullifierLeaf::zero().hash<HashingPolicy>();
     for (size_t i = 0; i < depth; ++i) {
         zero_hashes_[i] = current;
-        current = hash_pair_native(current, current);
+        current = HashingPolicy::hash_pair(current, current);
     }
 }
 
-template <typename Store>
-NullifierTree<Store>::NullifierTree(NullifierTree&& other)
-    : MerkleTree<Store>(std::move(other))
+template <typename Store, typename HashingPolicy>
+NullifierTree<Store, HashingPolicy>::NullifierTree(NullifierTree&& other)
+    : MerkleTree<Store, HashingPolicy>(std::move(other))
+    , leaves(std::move(other.leaves))
+    , leaf_indices(std::move(other.leaf_indices))
 {}
 
-template <typename Store> NullifierTree<Store>::~NullifierTree() {}
+template <typename Store, typename HashingPolicy> NullifierTree<Store, HashingPolicy>::~NullifierTree() {}
 
-template <typename Store> fr NullifierTree<Store>::update_element(fr const& value)
+template <typename Store, typename HashingPolicy>
+fr NullifierTree<Store, HashingPolicy>::update_element(fr const& value)
 {
     // Find the leaf with the value closest and less than `value`
     size_t current;
     bool is_already_present;
-    std::tie(current, is_already_present) = find_closest_leaf(leaves, value);
+    std::tie(current, is_already_present) = find_closest_leaf(leaf_indices, value);
 
     nullifier_leaf current_leaf = leaves[current].unwrap();
     WrappedNullifierLeaf new_leaf = WrappedNullifierLeaf(
@@ -67,23 +71,34 @@ template <typename Store> fr NullifierTree<Store>::update_element(fr const& valu
         leaves[current].set(current_leaf);
 
         // Insert the new leaf with (nextIndex, nextValue) of the current leaf
+        leaf_indices.emplace(uint256_t(value), leaves.size());
         leaves.push_back(new_leaf);
     }
 
     // Update the old leaf in the tree
-    auto old_leaf_hash = leaves[current].hash();
+    auto old_leaf_hash = leaves[current].hash<HashingPolicy>();
     index_t old_leaf_index = current;
     auto r = update_element(old_leaf_index, old_leaf_hash);
 
     // Insert the new leaf in the tree
-    auto new_leaf_hash = new_leaf.hash();
+    auto new_leaf_hash = new_leaf.hash<HashingPolicy>();
     index_t new_leaf_index = is_already_present ? old_leaf_index : leaves.size() - 1;
     r = update_element(new_leaf_index, new_leaf_hash);
 
     return r;
 }
 
-template class NullifierTree<MemoryStore>;
+template <typename Store, typename HashingPolicy>
+fr NullifierTree<Store, HashingPolicy>::batch_insert(std::vector<fr> const& values)
+{
+    for (size_t index : batch_insert_leaves(leaves, leaf_indices, values, false)) {
+        update_element(index, leaves[index].hash<HashingPolicy>());
+    }
+    return root();
+}
+
+template class NullifierTree<MemoryStore, PedersenHashPolicy>;
+template class NullifierTree<MemoryStore, Poseidon2HashPolicy>;
 
 } // namespace merkle_tree
 } // namespace stdlib
@@ -63,6 +63,43 @@ TEST(stdlib_nullifier_tree, test_kv_memory_vs_memory_consistency)
     EXPECT_EQ(db.root(), memdb.root());
 }
 
+TEST(stdlib_nullifier_tree, test_batch_insert)
+{
+    constexpr size_t depth = 10;
+    MemoryStore sequential_store;
+    NullifierTree sequential_tree(sequential_store, depth);
+    MemoryStore batch_store;
+    NullifierTree batch_tree(batch_store, depth);
+
+    std::vector<fr> values(VALUES.begin(), VALUES.begin() + 100);
+    values[10] = 0;
+    values[20] = values[30];
+    for (const auto& value : values) {
+        sequential_tree.update_element(value);
+    }
+    EXPECT_EQ(batch_tree.batch_insert(values), sequential_tree.root());
+    for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(batch_tree.get_hash_path(i), sequential_tree.get_hash_path(i));
+    }
+
+    EXPECT_EQ(batch_tree.update_element(VALUES[100]), sequential_tree.update_element(VALUES[100]));
+}
+
+TEST(stdlib_nullifier_tree, test_poseidon2_batch_insert)
+{
+    constexpr size_t depth = 10;
+    NullifierMemoryTree_<Poseidon2HashPolicy> memdb(depth);
+    MemoryStore store;
+    NullifierTree<MemoryStore, Poseidon2HashPolicy> db(store, depth);
+    EXPECT_EQ(db.root(), memdb.root());
+
+    std::vector<fr> values(VALUES.begin(), VALUES.begin() + 100);
+    EXPECT_EQ(db.batch_insert(values), memdb.batch_insert(values));
+    for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(db.get_hash_path(i), memdb.get_hash_path(i));
+    }
+}
+
 TEST(stdlib_nullifier_tree, test_size)
 {
     MemoryStore store;
@@ -66,18 +66,18 @@ template <class Flavor> void ProverInstance_<Flavor>::compute_witness(Circuit& c
         construct_databus_polynomials(circuit);
     }
 
-    // Initialise the sorted concatenated list polynomials for the lookup argument
-    for (auto& s_i : sorted_polynomials) {
-        s_i = Polynomial(dyadic_circuit_size);
-    }
-
     // The sorted list polynomials have (tables_size + lookups_size) populated entries. We define the index below so
     // that these entries are written into the last indices of the polynomials. The values on the first
     // dyadic_circuit_size - (tables_size + lookups_size) indices are automatically initialized to zero via the
-    // polynomial constructor.
+    // polynomial constructor, which only needs memory for the populated entries.
     size_t s_index = dyadic_circuit_size - tables_size - lookups_size;
     ASSERT(s_index > 0); // We need at least 1 row of zeroes for the permutation argument
 
+    // Initialise the sorted concatenated list polynomials for the lookup argument
+    for (auto& s_i : sorted_polynomials) {
+        s_i = Polynomial(dyadic_circuit_size, s_index, dyadic_circuit_size);
+    }
+
     for (auto& table : circuit.lookup_tables) {
         const fr table_index(table.table_index);
         auto& lookup_gates = table.lookup_gates;
@@ -156,15 +156,15 @@ template <class Flavor> void ProverInstance_<Flavor>::compute_witness(Circuit& c
  */
 template <class Flavor> void ProverInstance_<Flavor>::construct_ecc_op_wire_polynomials(auto& wire_polynomials)
 {
-    std::array<polynomial, Flavor::NUM_WIRES> op_wire_polynomials;
-    for (auto& poly : op_wire_polynomials) {
-        poly = static_cast<polynomial>(dyadic_circuit_size);
-    }
-
     // The ECC op wires are constructed to contain the op data on the appropriate range and to vanish everywhere else.
     // The op data is assumed to have already been stored at the correct location in the convetional wires so the data
     // can simply be copied over directly.
     const size_t op_wire_offset = Flavor::has_zero_row ? 1 : 0;
+    std::array<polynomial, Flavor::NUM_WIRES> op_wire_polynomials;
+    for (auto& poly : op_wire_polynomials) {
+        poly = polynomial(dyadic_circuit_size, op_wire_offset, op_wire_offset + num_ecc_op_gates);
+    }
+
     for (size_t poly_idx = 0; poly_idx < Flavor::NUM_WIRES; ++poly_idx) {
         for (size_t i = 0; i < num_ecc_op_gates; ++i) {
             size_t idx = i + op_wire_offset;
@@ -189,11 +189,12 @@ template <class Flavor>
 void ProverInstance_<Flavor>::construct_databus_polynomials(Circuit& circuit)
     requires IsGoblinFlavor<Flavor>
 {
-    polynomial public_calldata(dyadic_circuit_size);
-    polynomial calldata_read_counts(dyadic_circuit_size);
+    const size_t calldata_size = circuit.public_calldata.size();
+    polynomial public_calldata(dyadic_circuit_size, 0, calldata_size);
+    polynomial calldata_read_counts(dyadic_circuit_size, 0, calldata_size);
 
     // Note: We do not utilize a zero row for databus columns
-    for (size_t idx = 0; idx < circuit.public_calldata.size(); ++idx) {
+    for (size_t idx = 0; idx < calldata_size; ++idx) {
         public_calldata[idx] = circuit.get_variable(circuit.public_calldata[idx]);
         // TODO(https://github.com/AztecProtocol/barretenberg/issues/821): automate updating of read counts
         calldata_read_counts[idx] = circuit.calldata_read_counts[idx];
@@ -220,13 +221,13 @@ std::shared_ptr<typename Flavor::ProvingKey> ProverInstance_<Flavor>::compute_pr
 
     compute_first_and_last_lagrange_polynomials<Flavor>(proving_key.get());
 
-    polynomial poly_q_table_column_1(dyadic_circuit_size);
-    polynomial poly_q_table_column_2(dyadic_circuit_size);
-    polynomial poly_q_table_column_3(dyadic_circuit_size);
-    polynomial poly_q_table_column_4(dyadic_circuit_size);
-
     size_t offset = dyadic_circuit_size - tables_size;
 
+    polynomial poly_q_table_column_1(dyadic_circuit_size, offset, dyadic_circuit_size);
+    polynomial poly_q_table_column_2(dyadic_circuit_size, offset, dyadic_circuit_size);
+    polynomial poly_q_table_column_3(dyadic_circuit_size, offset, dyadic_circuit_size);
+    polynomial poly_q_table_column_4(dyadic_circuit_size, offset, dyadic_circuit_size);
+
     // Create lookup selector polynomials which interpolate each table column.
     // Our selector polys always need to interpolate the full subgroup size, so here we offset so as to
     // put the table column's values at the end. (The first gates are for non-lookup constraints).
@@ -234,13 +235,7 @@ std::shared_ptr<typename Flavor::ProvingKey> ProverInstance_<Flavor>::compute_pr
     //  ^^^^^^^^^  ^^^^^^^^  ^^^^^^^  ^nonzero to ensure uniqueness and to avoid infinity commitments
     //  |          table     randomness
     //  ignored, as used for regular constraints and padding to the next power of 2.
-
-    for (size_t i = 0; i < offset; ++i) {
-        poly_q_table_column_1[i] = 0;
-        poly_q_table_column_2[i] = 0;
-        poly_q_table_column_3[i] = 0;
-        poly_q_table_column_4[i] = 0;
-    }
+    // The polynomials' active range is the table, the rest is never written to and takes no memory.
 
     for (const auto& table : circuit.lookup_tables) {
         const fr table_index(table.table_index);
@@ -337,11 +332,14 @@ template <class Flavor> void ProverInstance_<Flavor>::compute_sorted_accumulator
 template <class Flavor> void ProverInstance_<Flavor>::compute_sorted_list_accumulator(FF eta)
 {
     const size_t circuit_size = proving_key->circuit_size;
+    // the sorted polynomials are all zero outside of the same active range, so s is as well
+    const size_t start = sorted_polynomials[0].start_index();
+    const size_t end = sorted_polynomials[0].end_index();
 
-    auto sorted_list_accumulator = Polynomial{ circuit_size };
+    auto sorted_list_accumulator = Polynomial{ circuit_size, start, end };
 
     // Construct s via Horner, i.e. s = s_1 + η(s_2 + η(s_3 + η*s_4))
-    for (size_t i = 0; i < circuit_size; ++i) {
+    for (size_t i = start; i < end; ++i) {
         FF T0 = sorted_polynomials[3][i];
         T0 *= eta;
         T0 += sorted_polynomials[2][i];
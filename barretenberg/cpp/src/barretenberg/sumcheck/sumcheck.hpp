@@ -50,19 +50,26 @@ template <typename Flavor> class SumcheckProver {
                                         *
             operations naturally operate on these groups of edges
 
+    *
+    * In prove(), the first NUM_STREAMED_ROUNDS rounds read the full polynomials directly, folding each edge at the
+    * previous challenges as it is read, so partially_evaluated_polynomials is only allocated once those rounds are
+    * done, at size n / 2^NUM_STREAMED_ROUNDS rather than n / 2.
     *
     * NOTE: With ~40 columns, prob only want to allocate 256 EdgeGroup's at once to keep stack under 1MB?
     * TODO(#224)(Cody): might want to just do C-style multidimensional array? for guaranteed adjacency?
     */
     PartiallyEvaluatedMultivariates partially_evaluated_polynomials;
 
+    // Streaming round j costs about one pass over the full polynomials on top of the relations, which is small next to
+    // the relations themselves while j is small
+    static constexpr size_t NUM_STREAMED_ROUNDS = 3;
+
     // prover instantiates sumcheck with circuit size and a prover transcript
     SumcheckProver(size_t multivariate_n, const std::shared_ptr<Transcript>& transcript)
         : transcript(transcript)
         , multivariate_n(multivariate_n)
         , multivariate_d(numeric::get_msb(multivariate_n))
-        , round(multivariate_n)
-        , partially_evaluated_polynomials(multivariate_n){};
+        , round(multivariate_n){};
 
     /**
      * @brief Compute univariate restriction place in transcript, generate challenge, partially evaluate,... repeat
@@ -81,22 +88,28 @@ template <typename Flavor> class SumcheckProver {
         std::vector<FF> multivariate_challenge;
         multivariate_challenge.reserve(multivariate_d);
 
-        // First round
-        // This populates partially_evaluated_polynomials.
-        auto round_univariate = round.compute_univariate(full_polynomials, relation_parameters, pow_univariate, alpha);
-        transcript->send_to_verifier("Sumcheck:univariate_0", round_univariate);
-        FF round_challenge = transcript->get_challenge("Sumcheck:u_0");
-        multivariate_challenge.emplace_back(round_challenge);
-        partially_evaluate(full_polynomials, multivariate_n, round_challenge);
-        pow_univariate.partially_evaluate(round_challenge);
-        round.round_size =
-            round.round_size >> 1; // TODO(#224)(Cody): Maybe partially_evaluate should do this and release memory?
+        // Streamed rounds
+        // The univariates are computed from the full polynomials, folded at the challenges so far on the fly. After the
+        // last of these rounds, this populates partially_evaluated_polynomials.
+        const size_t num_streamed_rounds = std::min(NUM_STREAMED_ROUNDS, multivariate_d);
+        std::vector<FF> fold_weights{ FF(1) };
+        for (size_t round_idx = 0; round_idx < num_streamed_rounds; round_idx++) {
+            auto round_univariate =
+                round.compute_univariate(full_polynomials, relation_parameters, pow_univariate, alpha, fold_weights);
+            transcript->send_to_verifier("Sumcheck:univariate_" + std::to_string(round_idx), round_univariate);
+            FF round_challenge = transcript->get_challenge("Sumcheck:u_" + std::to_string(round_idx));
+            multivariate_challenge.emplace_back(round_challenge);
+            fold_weights = extend_fold_weights(fold_weights, round_challenge);
+            pow_univariate.partially_evaluate(round_challenge);
+            round.round_size = round.round_size >> 1;
+        }
+        fold_evaluate(full_polynomials, round.round_size, fold_weights);
 
         // All but final round
         // We operate on partially_evaluated_polynomials in place.
-        for (size_t round_idx = 1; round_idx < multivariate_d; round_idx++) {
+        for (size_t round_idx = num_streamed_rounds; round_idx < multivariate_d; round_idx++) {
             // Write the round univariate to the transcript
-            round_univariate =
+            auto round_univariate =
                 round.compute_univariate(partially_evaluated_polynomials, relation_parameters, pow_univariate, alpha);
             transcript->send_to_verifier("Sumcheck:univariate_" + std::to_string(round_idx), round_univariate);
             FF round_challenge = transcript->get_challenge("Sumcheck:u_" + std::to_string(round_idx));
@@ -143,6 +156,7 @@ template <typename Flavor> class SumcheckProver {
      */
     void partially_evaluate(auto& polynomials, size_t round_size, FF round_challenge)
     {
+        allocate_partially_evaluated_polynomials(round_size >> 1);
         auto pep_view = partially_evaluated_polynomials.get_all();
         auto poly_view = polynomials.get_all();
         // after the first round, operate in place on partially_evaluated_polynomials
@@ -159,6 +173,7 @@ template <typename Flavor> class SumcheckProver {
     template <typename PolynomialT, std::size_t N>
     void partially_evaluate(std::array<PolynomialT, N>& polynomials, size_t round_size, FF round_challenge)
     {
+        allocate_partially_evaluated_polynomials(round_size >> 1);
         auto pep_view = partially_evaluated_polynomials.get_all();
         // after the first round, operate in place on partially_evaluated_polynomials
         parallel_for(polynomials.size(), [&](size_t j) {
@@ -167,6 +182,63 @@ template <typename Flavor> class SumcheckProver {
             }
         });
     };
+
+    /**
+     * @brief Given the weights folding the first j variables, return those folding the first j + 1, where the new
+     * variable takes the value round_challenge.
+     */
+    static std::vector<FF> extend_fold_weights(const std::vector<FF>& fold_weights, FF round_challenge)
+    {
+        const size_t fold_size = fold_weights.size();
+        std::vector<FF> result(fold_size << 1);
+        for (size_t t = 0; t < fold_size; ++t) {
+            result[t + fold_size] = fold_weights[t] * round_challenge;
+            result[t] = fold_weights[t] - result[t + fold_size];
+        }
+        return result;
+    }
+
+    /**
+     * @brief Populate partially_evaluated_polynomials with the full polynomials evaluated at all the challenges folded
+     * into fold_weights, i.e. with the result of as many calls to partially_evaluate.
+     *
+     * @param round_size The size of the folded hypercube, i.e. the full size over fold_weights.size()
+     */
+    void fold_evaluate(auto& polynomials, size_t round_size, std::span<const FF> fold_weights)
+    {
+        allocate_partially_evaluated_polynomials(round_size);
+        auto pep_view = partially_evaluated_polynomials.get_all();
+        auto poly_view = polynomials.get_all();
+        const size_t fold_size = fold_weights.size();
+        parallel_for(poly_view.size(), [&](size_t j) {
+            // only the rows folding in part of the active range can be non-zero
+            const size_t start = std::min(poly_view[j].start_index() / fold_size, round_size);
+            const size_t end = std::min((poly_view[j].end_index() + fold_size - 1) / fold_size, round_size);
+            auto pep = pep_view[j].begin();
+            std::fill(pep, pep + start, FF(0));
+            for (size_t i = start; i < end; ++i) {
+                FF result = 0;
+                for (size_t t = 0; t < fold_size; ++t) {
+                    result += fold_weights[t] * poly_view[j][i * fold_size + t];
+                }
+                pep[i] = result;
+            }
+            std::fill(pep + end, pep + round_size, FF(0));
+        });
+    }
+
+    /**
+     * @brief Make room for size evaluations of each polynomial in partially_evaluated_polynomials, which are all
+     * overwritten by the caller.
+     */
+    void allocate_partially_evaluated_polynomials(size_t size)
+    {
+        for (auto& poly : partially_evaluated_polynomials.get_all()) {
+            if (poly.size() < size) {
+                poly = typename Flavor::Polynomial(size, barretenberg::DontZeroMemory::FLAG);
+            }
+        }
+    }
 };
 
 template <typename Flavor> class SumcheckVerifier {
@@ -223,4 +223,56 @@ TEST_F(SumcheckTests, ProverAndVerifierSimple)
     run_test(/* expect_verified=*/false);
 }
 
+// Enough rounds that some of them run on the partially evaluated polynomials after the streamed ones
+TEST_F(SumcheckTests, ProverAndVerifierLarge)
+{
+    auto run_test = [](bool expect_verified) {
+        const size_t multivariate_d(7);
+        const size_t multivariate_n(1 << multivariate_d);
+
+        std::array<barretenberg::Polynomial<FF>, NUM_POLYNOMIALS> zero_polynomials;
+        for (auto& poly : zero_polynomials) {
+            poly = barretenberg::Polynomial<FF>(multivariate_n);
+        }
+        auto full_polynomials = construct_ultra_full_polynomials(zero_polynomials);
+
+        // Addition gates w_l + w_r - w_o = 0 on random values, with all other relations trivially satisfied
+        for (size_t i = 0; i < multivariate_n; ++i) {
+            full_polynomials.w_l[i] = FF::random_element();
+            full_polynomials.w_r[i] = FF::random_element();
+            full_polynomials.w_o[i] = full_polynomials.w_l[i] + full_polynomials.w_r[i];
+            full_polynomials.q_l[i] = 1;
+            full_polynomials.q_r[i] = 1;
+            full_polynomials.q_o[i] = -1;
+            full_polynomials.q_arith[i] = 1;
+        }
+        if (!expect_verified) {
+            full_polynomials.w_o[multivariate_n - 3] += 1;
+        }
+
+        auto prover_transcript = Flavor::Transcript::prover_init_empty();
+        auto sumcheck_prover = SumcheckProver<Flavor>(multivariate_n, prover_transcript);
+
+        FF prover_alpha = prover_transcript->get_challenge("alpha");
+        auto output = sumcheck_prover.prove(full_polynomials, {}, prover_alpha);
+
+        for (auto [full_poly, claimed_eval] :
+             zip_view(full_polynomials.get_all(), output.claimed_evaluations.get_all())) {
+            barretenberg::Polynomial<FF> poly(full_poly);
+            EXPECT_EQ(poly.evaluate_mle(output.challenge), claimed_eval);
+        }
+
+        auto verifier_transcript = Flavor::Transcript::verifier_init_empty(prover_transcript);
+
+        auto sumcheck_verifier = SumcheckVerifier<Flavor>(multivariate_n);
+        FF verifier_alpha = verifier_transcript->get_challenge("alpha");
+        auto verifier_output = sumcheck_verifier.verify({}, verifier_alpha, verifier_transcript);
+
+        EXPECT_EQ(verifier_output.verified.value(), expect_verified);
+    };
+
+    run_test(/* expect_verified=*/true);
+    run_test(/* expect_verified=*/false);
+}
+
 } // namespace test_sumcheck_round
@@ -38,11 +38,11 @@ namespace proof_system::honk::sumcheck {
   3 - 7
   4 - 8
 
- The polynomials Y1, Y2 are stored in an array in Multivariates. In the first round, these are arrays
- of spans living outside of the Multivariates object, and in sebsequent rounds these are arrays of field
- elements that are stored in the Multivariates. The rationale for adopting this model is to
- avoid copying the full-length polynomials; this way, the largest polynomial array stores in a
- Multivariates class is multivariates_n/2.
+ The polynomials Y1, Y2 are stored in an array in Multivariates. In the first rounds, these are arrays
+ of spans living outside of the Multivariates object, whose edges are folded at the previous round challenges as they
+ are read, and in subsequent rounds these are arrays of field elements that are stored in the Multivariates. The
+ rationale for adopting this model is to avoid copying the full-length polynomials; this way, the largest polynomial
+ array stored in a Multivariates class is a small fraction of multivariates_n.
 
  Note: This class uses recursive function calls with template parameters. This is a common trick that is used to force
  the compiler to unroll loops. The idea is that a function that is only called once will always be inlined, and since
@@ -68,6 +68,10 @@ template <typename Flavor> class SumcheckProverRound {
 
     SumcheckTupleOfTuplesOfUnivariates univariate_accumulators;
 
+    // Per-thread scratch space for compute_univariate, kept across rounds so that it is only allocated once
+    std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators;
+    std::vector<ExtendedEdges> thread_extended_edges;
+
     // Prover constructor
     SumcheckProverRound(size_t initial_round_size)
         : round_size(initial_round_size)
@@ -89,8 +93,48 @@ template <typename Flavor> class SumcheckProverRound {
                       size_t edge_idx)
     {
         for (auto [extended_edge, multivariate] : zip_view(extended_edges.get_all(), multivariates.get_all())) {
-            barretenberg::Univariate<FF, 2> edge({ multivariate[edge_idx], multivariate[edge_idx + 1] });
-            extended_edge = edge.template extend_to<MAX_PARTIAL_RELATION_LENGTH>();
+            extend_edge(extended_edge, multivariate[edge_idx], multivariate[edge_idx + 1]);
+        }
+    }
+
+    /**
+     * @brief Write the values at 0, ..., MAX_PARTIAL_RELATION_LENGTH - 1 of the linear univariate through (0, lo) and
+     * (1, hi) straight into extended_edge.
+     */
+    template <typename ExtendedUnivariate>
+    static void extend_edge(ExtendedUnivariate& extended_edge, const FF& lo, const FF& hi)
+    {
+        const FF delta = hi - lo;
+        extended_edge.value_at(0) = lo;
+        for (size_t idx = 1; idx < MAX_PARTIAL_RELATION_LENGTH; idx++) {
+            extended_edge.value_at(idx) = extended_edge.value_at(idx - 1) + delta;
+        }
+    }
+
+    /**
+     * @brief Extend each edge in the edge group at edge_idx of the multivariates folded at the previous challenges.
+     *
+     * @details Vertex p of the folded hypercube is the combination of the 2^j vertices p * 2^j + t of the full one
+     * with the weights fold_weights[t] = ∏ᵢ (tᵢ ? uᵢ : 1 - uᵢ), so the edges of round j can be read straight from the
+     * full polynomials, without first storing their partial evaluations.
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
+    void extend_folded_edges(ExtendedEdges& extended_edges,
+                             const ProverPolynomialsOrPartiallyEvaluatedMultivariates& multivariates,
+                             size_t edge_idx,
+                             std::span<const FF> fold_weights)
+    {
+        const size_t fold_size = fold_weights.size();
+        const size_t lo_idx = edge_idx * fold_size;
+        const size_t hi_idx = lo_idx + fold_size;
+        for (auto [extended_edge, multivariate] : zip_view(extended_edges.get_all(), multivariates.get_all())) {
+            FF lo = 0;
+            FF hi = 0;
+            for (size_t t = 0; t < fold_size; ++t) {
+                lo += fold_weights[t] * multivariate[lo_idx + t];
+                hi += fold_weights[t] * multivariate[hi_idx + t];
+            }
+            extend_edge(extended_edge, lo, hi);
         }
     }
 
@@ -98,21 +142,19 @@ template <typename Flavor> class SumcheckProverRound {
      * @brief Return the evaluations of the univariate restriction (S_l(X_l) in the thesis) at num_multivariates-many
      * values. Most likely this will end up being S_l(0), ... , S_l(t-1) where t is around 12. At the end, reset all
      * univariate accumulators to be zero.
+     *
+     * @param fold_weights If it has more than one entry, the polynomials are read as folded at the previous round
+     * challenges, see extend_folded_edges. round_size is the size of the folded hypercube.
      */
     template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
     barretenberg::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH> compute_univariate(
         ProverPolynomialsOrPartiallyEvaluatedMultivariates& polynomials,
         const proof_system::RelationParameters<FF>& relation_parameters,
         const barretenberg::PowUnivariate<FF>& pow_univariate,
-        const FF alpha)
+        const FF alpha,
+        std::span<const FF> fold_weights = {})
     {
-        // Precompute the vector of required powers of zeta
-        // TODO(luke): Parallelize this
-        std::vector<FF> pow_challenges(round_size >> 1);
-        pow_challenges[0] = pow_univariate.partial_evaluation_constant;
-        for (size_t i = 1; i < (round_size >> 1); ++i) {
-            pow_challenges[i] = pow_challenges[i - 1] * pow_univariate.zeta_pow_sqr;
-        }
+        const bool is_folded = fold_weights.size() > 1;
 
         // Determine number of threads for multithreading.
         // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
@@ -123,42 +165,47 @@ template <typename Flavor> class SumcheckProverRound {
             barretenberg::thread_utils::calculate_num_threads_pow2(round_size, min_iterations_per_thread);
         size_t iterations_per_thread = round_size / num_threads; // actual iterations per thread
 
-        // Construct univariate accumulator containers; one per thread
-        std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(num_threads);
-        for (auto& accum : thread_univariate_accumulators) {
-            Utils::zero_univariates(accum);
+        // Univariate accumulators and extended edges, one per thread. Each thread zeroes its own accumulators.
+        if (thread_univariate_accumulators.size() < num_threads) {
+            thread_univariate_accumulators.resize(num_threads);
+            thread_extended_edges.resize(num_threads);
         }
 
-        // Construct extended edge containers; one per thread
-        std::vector<ExtendedEdges> extended_edges;
-        extended_edges.resize(num_threads);
-
         // Accumulate the contribution from each sub-relation accross each edge of the hyper-cube
         parallel_for(num_threads, [&](size_t thread_idx) {
             size_t start = thread_idx * iterations_per_thread;
             size_t end = (thread_idx + 1) * iterations_per_thread;
+            auto& accumulators = thread_univariate_accumulators[thread_idx];
+            auto& extended_edges = thread_extended_edges[thread_idx];
+            Utils::zero_univariates(accumulators);
+
+            // The pow polynomial's contribution c_l ⋅ ζ_{l+1}ⁱ for the first edge i = start / 2 of this thread. Each
+            // thread computes its own block of these powers, so they are never stored.
+            FF pow_challenge = pow_univariate.partial_evaluation_constant *
+                               pow_univariate.zeta_pow_sqr.pow(static_cast<uint64_t>(start >> 1));
 
             // For each edge_idx = 2i, we need to multiply the whole contribution by zeta^{2^{2i}}
             // This means that each univariate for each relation needs an extra multiplication.
             for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
-                extend_edges(extended_edges[thread_idx], polynomials, edge_idx);
-
-                // Update the pow polynomial's contribution c_l ⋅ ζ_{l+1}ⁱ for the next edge.
-                FF pow_challenge = pow_challenges[edge_idx >> 1];
+                if (is_folded) {
+                    extend_folded_edges(extended_edges, polynomials, edge_idx, fold_weights);
+                } else {
+                    extend_edges(extended_edges, polynomials, edge_idx);
+                }
 
                 // Compute the i-th edge's univariate contribution,
                 // scale it by the pow polynomial's constant and zeta power "c_l ⋅ ζ_{l+1}ⁱ"
                 // and add it to the accumulators for Sˡ(Xₗ)
-                accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
-                                                extended_edges[thread_idx],
-                                                relation_parameters,
-                                                pow_challenge);
+                accumulate_relation_univariates(accumulators, extended_edges, relation_parameters, pow_challenge);
+
+                // Update the pow polynomial's contribution for the next edge
+                pow_challenge *= pow_univariate.zeta_pow_sqr;
             }
         });
 
         // Accumulate the per-thread univariate accumulators into a single set of accumulators
-        for (auto& accumulators : thread_univariate_accumulators) {
-            Utils::add_nested_tuples(univariate_accumulators, accumulators);
+        for (size_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+            Utils::add_nested_tuples(univariate_accumulators, thread_univariate_accumulators[thread_idx]);
         }
         // Batch the univariate contributions from each sub-relation to obtain the round univariate
         return batch_over_relations<barretenberg::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH>>(
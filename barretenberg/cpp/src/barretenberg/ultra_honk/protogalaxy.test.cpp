@@ -113,6 +113,42 @@ TEST_F(ProtoGalaxyTests, PerturbatorCoefficients)
     }
 }
 
+// Large enough for the tree to be split across threads
+TEST_F(ProtoGalaxyTests, PerturbatorCoefficientsLarge)
+{
+    const size_t log_instance_size(10);
+    const size_t instance_size(1 << log_instance_size);
+    std::vector<FF> betas(log_instance_size);
+    std::vector<FF> deltas(log_instance_size);
+    for (size_t idx = 0; idx < log_instance_size; idx++) {
+        betas[idx] = FF::random_element();
+        deltas[idx] = FF::random_element();
+    }
+    std::vector<FF> full_honk_evaluations(instance_size);
+    for (auto& eval : full_honk_evaluations) {
+        eval = FF::random_element();
+    }
+    auto perturbator = ProtoGalaxyProver::construct_perturbator_coefficients(betas, deltas, full_honk_evaluations);
+    EXPECT_EQ(perturbator.size(), log_instance_size + 1);
+
+    // F(X) = sum_i f_i * pow_i(β + δX)
+    auto x = FF::random_element();
+    std::vector<FF> betas_at_x(log_instance_size);
+    for (size_t idx = 0; idx < log_instance_size; idx++) {
+        betas_at_x[idx] = betas[idx] + deltas[idx] * x;
+    }
+    auto pow_betas_at_x = ProtoGalaxyProver::compute_pow_polynomial_at_values(betas_at_x, instance_size);
+    auto expected = FF(0);
+    for (size_t i = 0; i < instance_size; i++) {
+        expected += full_honk_evaluations[i] * pow_betas_at_x[i];
+    }
+    auto perturbator_at_x = FF(0);
+    for (size_t i = perturbator.size(); i > 0; i--) {
+        perturbator_at_x = perturbator_at_x * x + perturbator[i - 1];
+    }
+    EXPECT_EQ(perturbator_at_x, expected);
+}
+
 TEST_F(ProtoGalaxyTests, PerturbatorPolynomial)
 {
     const size_t log_instance_size(3);
@@ -54,9 +54,11 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_wire_commitment
 
     // Commit to the first three wire polynomials
     // We only commit to the fourth wire polynomial after adding memory recordss
-    witness_commitments.w_l = commitment_key->commit(proving_key->w_l);
-    witness_commitments.w_r = commitment_key->commit(proving_key->w_r);
-    witness_commitments.w_o = commitment_key->commit(proving_key->w_o);
+    auto wire_commitments = commitment_key->commit_batch(
+        std::vector<std::span<const FF>>{ proving_key->w_l, proving_key->w_r, proving_key->w_o });
+    witness_commitments.w_l = wire_commitments[0];
+    witness_commitments.w_r = wire_commitments[1];
+    witness_commitments.w_o = wire_commitments[2];
 
     auto wire_comms = witness_commitments.get_wires();
     auto labels = commitment_labels.get_wires();
@@ -65,11 +67,11 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_wire_commitment
     }
 
     if constexpr (IsGoblinFlavor<Flavor>) {
-        // Commit to Goblin ECC op wires
-        witness_commitments.ecc_op_wire_1 = commitment_key->commit(proving_key->ecc_op_wire_1);
-        witness_commitments.ecc_op_wire_2 = commitment_key->commit(proving_key->ecc_op_wire_2);
-        witness_commitments.ecc_op_wire_3 = commitment_key->commit(proving_key->ecc_op_wire_3);
-        witness_commitments.ecc_op_wire_4 = commitment_key->commit(proving_key->ecc_op_wire_4);
+        // Commit to Goblin ECC op wires. These are only non-zero on the op queue rows
+        witness_commitments.ecc_op_wire_1 = commitment_key->commit_sparse(proving_key->ecc_op_wire_1);
+        witness_commitments.ecc_op_wire_2 = commitment_key->commit_sparse(proving_key->ecc_op_wire_2);
+        witness_commitments.ecc_op_wire_3 = commitment_key->commit_sparse(proving_key->ecc_op_wire_3);
+        witness_commitments.ecc_op_wire_4 = commitment_key->commit_sparse(proving_key->ecc_op_wire_4);
 
         auto op_wire_comms = instance->witness_commitments.get_ecc_op_wires();
         auto labels = commitment_labels.get_ecc_op_wires();
@@ -77,9 +79,9 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_wire_commitment
             transcript->send_to_verifier(labels[idx], op_wire_comms[idx]);
         }
 
-        // Commit to DataBus columns
-        witness_commitments.calldata = commitment_key->commit(proving_key->calldata);
-        witness_commitments.calldata_read_counts = commitment_key->commit(proving_key->calldata_read_counts);
+        // Commit to DataBus columns. These are only non-zero on the first few rows
+        witness_commitments.calldata = commitment_key->commit_sparse(proving_key->calldata);
+        witness_commitments.calldata_read_counts = commitment_key->commit_sparse(proving_key->calldata_read_counts);
         transcript->send_to_verifier(commitment_labels.calldata, instance->witness_commitments.calldata);
         transcript->send_to_verifier(commitment_labels.calldata_read_counts,
                                      instance->witness_commitments.calldata_read_counts);
@@ -99,8 +101,10 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_sorted_list_acc
     auto& witness_commitments = instance->witness_commitments;
     // Commit to the sorted withness-table accumulator and the finalized (i.e. with memory records) fourth wire
     // polynomial
-    witness_commitments.sorted_accum = commitment_key->commit(instance->prover_polynomials.sorted_accum);
-    witness_commitments.w_4 = commitment_key->commit(instance->prover_polynomials.w_4);
+    auto commitments = commitment_key->commit_batch(std::vector<std::span<const FF>>{
+        instance->prover_polynomials.sorted_accum, instance->prover_polynomials.w_4 });
+    witness_commitments.sorted_accum = commitments[0];
+    witness_commitments.w_4 = commitments[1];
 
     transcript->send_to_verifier(commitment_labels.sorted_accum, instance->witness_commitments.sorted_accum);
     transcript->send_to_verifier(commitment_labels.w_4, instance->witness_commitments.w_4);
@@ -120,7 +124,7 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_log_derivative_
     if constexpr (IsGoblinFlavor<Flavor>) {
         instance->compute_logderivative_inverse(beta, gamma);
         instance->witness_commitments.lookup_inverses =
-            commitment_key->commit(instance->prover_polynomials.lookup_inverses);
+            commitment_key->commit_sparse(instance->prover_polynomials.lookup_inverses);
         transcript->send_to_verifier(commitment_labels.lookup_inverses, instance->witness_commitments.lookup_inverses);
     }
 }
@@ -135,8 +139,10 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_grand_product_c
     instance->compute_grand_product_polynomials(relation_parameters.beta, relation_parameters.gamma);
 
     auto& witness_commitments = instance->witness_commitments;
-    witness_commitments.z_perm = commitment_key->commit(instance->prover_polynomials.z_perm);
-    witness_commitments.z_lookup = commitment_key->commit(instance->prover_polynomials.z_lookup);
+    auto commitments = commitment_key->commit_batch(
+        std::vector<std::span<const FF>>{ instance->prover_polynomials.z_perm, instance->prover_polynomials.z_lookup });
+    witness_commitments.z_perm = commitments[0];
+    witness_commitments.z_lookup = commitments[1];
     transcript->send_to_verifier(commitment_labels.z_perm, instance->witness_commitments.z_perm);
     transcript->send_to_verifier(commitment_labels.z_lookup, instance->witness_commitments.z_lookup);
 }
@@ -35,6 +35,7 @@ using AppendOnlySnapshot = abis::AppendOnlyTreeSnapshot<NT>;
 // Tree Aliases
 using MemoryStore = stdlib::merkle_tree::MemoryStore;
 using MerkleTree = stdlib::merkle_tree::MerkleTree<MemoryStore>;
+using MemoryTree = stdlib::merkle_tree::MemoryTree;
 using NullifierTree = stdlib::merkle_tree::NullifierMemoryTree;
 using NullifierLeafPreimage = abis::NullifierLeafPreimage<NT>;
 
@@ -90,23 +90,21 @@ std::vector<NT::fr> calculate_contract_leaves(BaseRollupInputs const& baseRollup
 
 NT::fr calculate_contract_subtree(std::vector<NT::fr> contract_leaves)
 {
-    MemoryStore contracts_tree_store;
-    MerkleTree contracts_tree(contracts_tree_store, CONTRACT_SUBTREE_HEIGHT);
-
-
     // Compute the merkle root of a contract subtree
     // Contracts subtree
+    std::vector<std::pair<size_t, NT::fr>> updates;
+    updates.reserve(contract_leaves.size());
     for (size_t i = 0; i < contract_leaves.size(); i++) {
-        contracts_tree.update_element(i, contract_leaves[i]);
+        updates.emplace_back(i, contract_leaves[i]);
     }
-    return contracts_tree.root();
+    MemoryTree contracts_tree(CONTRACT_SUBTREE_HEIGHT);
+    return contracts_tree.update_elements(updates);
 }
 
 NT::fr calculate_commitments_subtree(DummyBuilder& builder, BaseRollupInputs const& baseRollupInputs)
 {
-    MemoryStore commitments_tree_store;
-    MerkleTree commitments_tree(commitments_tree_store, NOTE_HASH_SUBTREE_HEIGHT);
-
+    std::vector<std::pair<size_t, NT::fr>> updates;
+    updates.reserve(2 * MAX_NEW_COMMITMENTS_PER_TX);
 
     for (size_t i = 0; i < 2; i++) {
         auto new_commitments = baseRollupInputs.kernel_data[i].public_inputs.end.new_commitments;
@@ -117,13 +115,13 @@ NT::fr calculate_commitments_subtree(DummyBuilder& builder, BaseRollupInputs con
                           CircuitErrorCode::BASE__INCORRECT_NUM_OF_NEW_COMMITMENTS);
 
         for (size_t j = 0; j < new_commitments.size(); j++) {
-            // todo: batch insert
-            commitments_tree.update_element(i * MAX_NEW_COMMITMENTS_PER_TX + j, new_commitments[j]);
+            updates.emplace_back(i * MAX_NEW_COMMITMENTS_PER_TX + j, new_commitments[j]);
         }
     }
 
-    // Commitments subtree
-    return commitments_tree.root();
+    // Commitments subtree, with each node hashed once
+    MemoryTree commitments_tree(NOTE_HASH_SUBTREE_HEIGHT);
+    return commitments_tree.update_elements(updates);
 }
 
 /**
@@ -174,14 +172,15 @@ NT::fr create_nullifier_subtree(
     std::array<NullifierLeafPreimage, MAX_NEW_NULLIFIERS_PER_TX * 2> const& nullifier_leaves)
 {
     // Build a merkle tree of the nullifiers
-    MemoryStore nullifier_subtree_store;
-    MerkleTree nullifier_subtree(nullifier_subtree_store, NULLIFIER_SUBTREE_HEIGHT);
+    std::vector<std::pair<size_t, NT::fr>> updates;
+    updates.reserve(nullifier_leaves.size());
     for (size_t i = 0; i < nullifier_leaves.size(); i++) {
         // hash() checks if nullifier is empty (and if so returns 0)
-        nullifier_subtree.update_element(i, nullifier_leaves[i].hash());
+        updates.emplace_back(i, nullifier_leaves[i].hash());
     }
 
-    return nullifier_subtree.root();
+    MemoryTree nullifier_subtree(NULLIFIER_SUBTREE_HEIGHT);
+    return nullifier_subtree.update_elements(updates);
 }
 
 /**
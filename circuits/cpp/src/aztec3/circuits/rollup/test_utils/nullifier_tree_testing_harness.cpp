@@ -7,6 +7,7 @@
 
 using NullifierMemoryTree = proof_system::plonk::stdlib::merkle_tree::NullifierMemoryTree;
 using nullifier_leaf = proof_system::plonk::stdlib::merkle_tree::nullifier_leaf;
+using proof_system::plonk::stdlib::merkle_tree::find_closest_leaf;
 
 NullifierMemoryTreeTestingHarness::NullifierMemoryTreeTestingHarness(size_t depth) : NullifierMemoryTree(depth) {}
 
@@ -49,14 +50,15 @@ NullifierMemoryTreeTestingHarness::circuit_prep_batch_insert(std::vector<fr> con
     nullifier_leaf const empty_leaf = { 0, 0, 0 };
     uint32_t const empty_index = 0;
 
-    // Find the leaf with the value closest and less than `value` for each value
+    // Find the leaf with the value closest and less than `value` for each value. Only the pointers of existing leaves
+    // change below, so the tree's value index stays valid throughout.
     for (size_t i = 0; i < values.size(); ++i) {
         auto new_value = values[i];
         auto insertion_index = start_insertion_index + i;
 
         size_t current = 0;
         bool is_already_present = false;
-        std::tie(current, is_already_present) = find_closest_leaf(leaves_, new_value);
+        std::tie(current, is_already_present) = find_closest_leaf(leaf_indices_, new_value);
 
         // If the inserted value is 0, then we ignore and provide a dummy low nullifier
         if (new_value == 0) {
@@ -145,7 +147,7 @@ std::pair<nullifier_leaf, size_t> NullifierMemoryTreeTestingHarness::find_lower(
 {
     size_t current = 0;
     bool is_already_present = false;
-    std::tie(current, is_already_present) = find_closest_leaf(leaves_, value);
+    std::tie(current, is_already_present) = find_closest_leaf(leaf_indices_, value);
 
     // TODO: handle is already present case
     if (!is_already_present) {
@@ -14,6 +14,9 @@ using aztec3::utils::types::NativeTypes;
  */
 class NullifierMemoryTreeTestingHarness : public proof_system::plonk::stdlib::merkle_tree::NullifierMemoryTree {
     using nullifier_leaf = proof_system::plonk::stdlib::merkle_tree::nullifier_leaf;
+    // The trees are templates over the hash, so their injected class names are MemoryTree_ and NullifierMemoryTree_
+    using MemoryTree = proof_system::plonk::stdlib::merkle_tree::MemoryTree;
+    using NullifierMemoryTree = proof_system::plonk::stdlib::merkle_tree::NullifierMemoryTree;
 
   public:
     explicit NullifierMemoryTreeTestingHarness(size_t depth);
@@ -22,6 +25,7 @@ class NullifierMemoryTreeTestingHarness : public proof_system::plonk::stdlib::me
     using MemoryTree::root;
     using MemoryTree::update_element;
 
+    using NullifierMemoryTree::batch_insert;
     using NullifierMemoryTree::update_element;
 
     using NullifierMemoryTree::get_hashes;
@@ -54,5 +58,6 @@ class NullifierMemoryTreeTestingHarness : public proof_system::plonk::stdlib::me
     using MemoryTree::hashes_;
     using MemoryTree::root_;
     using MemoryTree::total_size_;
+    using NullifierMemoryTree::leaf_indices_;
     using NullifierMemoryTree::leaves_;
 };
\ No newline at end of file
@@ -431,9 +431,11 @@ RootRollupInputs get_root_rollup_inputs(utils::DummyBuilder& builder,
 NullifierMemoryTreeTestingHarness get_initial_nullifier_tree_empty()
 {
     NullifierMemoryTreeTestingHarness nullifier_tree = NullifierMemoryTreeTestingHarness(NULLIFIER_TREE_HEIGHT);
+    std::vector<fr> initial_values;
     for (size_t i = 0; i < (MAX_NEW_NULLIFIERS_PER_TX * 2 - 1); i++) {
-        nullifier_tree.update_element(i + 1);
+        initial_values.emplace_back(i + 1);
     }
+    nullifier_tree.batch_insert(initial_values);
     return nullifier_tree;
 }
 
@@ -446,9 +448,7 @@ NullifierMemoryTreeTestingHarness get_initial_nullifier_tree_empty()
 NullifierMemoryTreeTestingHarness get_initial_nullifier_tree(const std::vector<fr>& initial_values)
 {
     NullifierMemoryTreeTestingHarness nullifier_tree = NullifierMemoryTreeTestingHarness(NULLIFIER_TREE_HEIGHT);
-    for (const auto& initial_value : initial_values) {
-        nullifier_tree.update_element(initial_value);
-    }
+    nullifier_tree.batch_insert(initial_values);
     return nullifier_tree;
 }
 
@@ -513,8 +513,8 @@ nullifier_tree_testing_values generate_nullifier_tree_testing_values_explicit(
             new_nullifiers_kernel_2[i - MAX_NEW_NULLIFIERS_PER_TX] = insertion_val;
         }
         insertion_values.push_back(insertion_val);
-        reference_tree.update_element(insertion_val);
     }
+    reference_tree.batch_insert(insertion_values);
 
     // Get the hash paths etc from the insertion values
     auto witnesses_and_preimages = nullifier_tree.circuit_prep_batch_insert(insertion_values);